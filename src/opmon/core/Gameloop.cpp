@@ -12,18 +12,35 @@ File under GNU GPL v3.0 license
 #include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <chrono>
 #include <functional>
+#include <future>
 #include <algorithm>
 #include <utility>
 
 #include "../../utils/StringKeys.hpp"
 #include "../screens/mainmenu/MainMenuCtrl.hpp"
+#include "../screens/overworld/OverworldCtrl.hpp"
+#include "Player.hpp"
 #include "src/utils/ResourceLoader.hpp"
 #include "src/opmon/core/GameStatus.hpp"
 #include "src/opmon/core/UiData.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
 #include "src/opmon/view/ui/Window.hpp"
 #include "src/utils/exceptions.hpp"
+#include "src/utils/input.hpp"
+#include "src/utils/mainthread.hpp"
+#include "src/utils/profiler.hpp"
+#include "system/path.hpp"
+
+//Number of simulation ticks per second. The movements and animations are defined per tick, so this sets the game speed.
+#define TICKS_PER_SECOND 30
+//Maximum number of ticks simulated before drawing a frame. If the game lags more than that, the remaining time is dropped.
+#define MAX_TICKS_PER_FRAME 5
+//Time spent running the loading thread's tasks between two frames of the loading screen, in milliseconds
+#define LOADING_TASKS_DURATION 15
 
 namespace OpMon {
 
@@ -33,6 +50,8 @@ namespace OpMon {
         _gameScreens.push(std::move(firstCtrl));
     }
 
+    GameLoop::~GameLoop() = default;
+
     GameStatus GameLoop::operator()() {
 
         std::unique_ptr<Ui::Window, std::function<void(Ui::Window *)>> window(new Ui::Window(), [](Ui::Window *w) {
@@ -54,71 +73,105 @@ namespace OpMon {
 
         GameStatus status{GameStatus::CONTINUE};
 
+        const sf::Time tickDuration = sf::seconds(1.f / TICKS_PER_SECOND);
+        sf::Clock tickClock;
+        //Time not simulated yet. Each simulation tick consumes tickDuration.
+        sf::Time lag = sf::Time::Zero;
+
         while(status != GameStatus::STOP && status != GameStatus::REBOOT) {
             try {
                 status = GameStatus::CONTINUE;
-
-                //Debug frame by frame
-                while(sf::Keyboard::isKeyPressed(sf::Keyboard::F2) && !(sf::Keyboard::isKeyPressed(fbfType) && hasBeenReleased)) {
-                    if(!sf::Keyboard::isKeyPressed(fbfType)) {
-                        hasBeenReleased = true;
-                    }
+                Utils::Profiler::frameMark();
+                //Runs the tasks of the threads loading in the background (see Overworld::prefetchMaps)
+                Utils::MainThread::processTasks(std::chrono::milliseconds(0));
+                uidata->getJukebox().update();
+                if(Utils::Input::isReplayOver()) {
+                    Utils::Log::oplog("End of the replay.");
+                    status = GameStatus::STOP;
+                    break;
                 }
-                hasBeenReleased = false;
 
                 //Gets the current game screen's controller
                 auto *ctrl = _gameScreens.top().get();
                 sf::Event event;
 
                 //process all pending SFML events
-                while(status == GameStatus::CONTINUE) {
-                    bool isEvent = window->getWindow().pollEvent(event);
-                    if(isEvent == false)
-                        event.type = sf::Event::SensorChanged;
-                    _checkWindowResize(event, *window);
-                    status = _checkQuit(event);
-                    if(status == GameStatus::STOP || status == GameStatus::REBOOT)
-                        break;
-                    status = ctrl->checkEvent(event);
-                    if(isEvent == false) {
-                        break;
+                {
+                    Utils::Profiler::Zone zone("Events");
+                    while(status == GameStatus::CONTINUE && Utils::Input::pollEvent(&window->getWindow(), event)) {
+                        _checkWindowResize(event, *window);
+                        _checkProfilerDump(event);
+                        _checkFrameByFrame(event);
+                        status = _checkQuit(event);
+                        if(status == GameStatus::STOP || status == GameStatus::REBOOT)
+                            break;
+                        status = ctrl->checkEvent(event);
                     }
                 }
 
+                lag += tickClock.restart();
+                if(frameByFrame) {
+                    //In frame by frame mode, one step is exactly one tick, whatever the time spent waiting.
+                    lag = stepFrame ? tickDuration : sf::Time::Zero;
+                    stepFrame = false;
+                } else if(lag > tickDuration * (float)MAX_TICKS_PER_FRAME) {
+                    lag = tickDuration * (float)MAX_TICKS_PER_FRAME;
+                }
+
                 if(status == GameStatus::WIN_REBOOT) {
                     window->reboot(uidata->getOptions());
                     status = GameStatus::CONTINUE;
                 }
 
-                if(status == GameStatus::CONTINUE) {
-                    // frame update & draw
-                    status = ctrl->update(window->getFrame());
-                }
-
-                if(status == GameStatus::NEXT || status == GameStatus::PREVIOUS || status == GameStatus::NEXT_NLS || status == GameStatus::PREVIOUS_NLS) {
-                    if(status == GameStatus::NEXT) {
-                        window->getFrame().clear(sf::Color(74, 81, 148));
-                        window->getFrame().draw(loadingTxt);
-                        window->refresh();
-                    } else {
-                        status = ((status == GameStatus::NEXT_NLS) ? GameStatus::NEXT : GameStatus::PREVIOUS);
+                //Simulation ticks. When replaying, the recorded events must be processed before the tick they were recorded in.
+                while(status == GameStatus::CONTINUE && lag >= tickDuration && !Utils::Input::hasPendingEvents()) {
+                    lag -= tickDuration;
+                    //No event : lets the screen check the keyboard state (continuous inputs) once per tick
+                    event.type = sf::Event::SensorChanged;
+                    status = _checkQuit(event);
+                    if(status == GameStatus::STOP || status == GameStatus::REBOOT)
+                        break;
+                    {
+                        Utils::Profiler::Zone zone("Events");
+                        status = ctrl->checkEvent(event);
                     }
-                    if(status == GameStatus::NEXT) {
-                        ctrl->loadNextScreen();
+                    if(status == GameStatus::CONTINUE) {
+                        // tick update
+                        Utils::Profiler::Zone zone("Update");
+                        status = ctrl->update(window->getFrame());
                     }
+                    Utils::Input::nextTick();
+                }
+
+                if(status == GameStatus::NEXT) {
+                    Utils::Profiler::Zone zone("Loading");
+                    status = _loadNextScreen(ctrl, *window, loadingTxt);
+                } else if(status == GameStatus::NEXT_NLS) {
+                    //No loading screen : the next screen is quick to load
+                    status = GameStatus::NEXT;
+                    ctrl->loadNextScreen();
+                } else if(status == GameStatus::PREVIOUS_NLS) {
+                    status = GameStatus::PREVIOUS;
                 }
 
                 switch(status) {
-                case GameStatus::NEXT: //Pauses the current screen and passes to the next
-                    ctrl->suspend();
-                    _gameScreens.push(ctrl->getNextGameScreen());
-                    break;
-                case GameStatus::PREVIOUS: //Deletes the current screen and returns to the previous one
-                    _gameScreens.pop();
-                    _gameScreens.top()->resume();
+                case GameStatus::NEXT:
+                case GameStatus::PREVIOUS:
+                    _changeScreen(status, ctrl);
+                    //The loading time must not be caught up by the new screen
+                    tickClock.restart();
+                    lag = sf::Time::Zero;
                     break;
                 case GameStatus::CONTINUE:
-                    window->refresh();
+                    //Frame draw, between the last two ticks
+                    {
+                        Utils::Profiler::Zone zone("Draw");
+                        ctrl->draw(window->getFrame(), lag / tickDuration);
+                    }
+                    {
+                        Utils::Profiler::Zone zone("Refresh");
+                        window->refresh();
+                    }
                     break;
                 default:
                     break;
@@ -140,14 +193,142 @@ namespace OpMon {
         return status;
     }
 
+    GameStatus GameLoop::runHeadless(unsigned int ticks) {
+        AGameScreen::renderEnabled = false;
+        Utils::Input::setKeyboardEnabled(false);
+
+        //Skips the menus : starts directly in the overworld, like after the start scene.
+        headlessPlayer = std::make_unique<Player>();
+        headlessPlayer->setMapID("Player's room");
+        headlessPlayer->getPosition().setDir(Side::TO_UP);
+        _gameScreens = {};
+        _gameScreens.push(std::make_unique<OverworldCtrl>(*headlessPlayer, uidata.get()));
+
+        //Only given to update() : never created nor drawn, since the rendering is disabled. The textures are still created, with an OpenGL context.
+        sf::RenderTexture frame;
+        sf::Event event;
+
+        Utils::Log::oplog("Starting headless run (" + std::to_string(ticks) + " ticks)");
+        auto start = std::chrono::steady_clock::now();
+        unsigned int tick = 0;
+        for(; tick < ticks && !Utils::Input::isReplayOver(); tick++) {
+            Utils::Profiler::frameMark();
+            Utils::MainThread::processTasks(std::chrono::milliseconds(0));
+            uidata->getJukebox().update();
+            auto *ctrl = _gameScreens.top().get();
+            GameStatus status = GameStatus::CONTINUE;
+            //Replayed events
+            while(status == GameStatus::CONTINUE && Utils::Input::pollEvent(nullptr, event)) {
+                status = ctrl->checkEvent(event);
+            }
+            if(status == GameStatus::CONTINUE) {
+                event.type = sf::Event::SensorChanged;
+                status = ctrl->checkEvent(event);
+            }
+            if(status == GameStatus::CONTINUE) {
+                Utils::Profiler::Zone zone("Update");
+                status = ctrl->update(frame);
+            }
+            Utils::Input::nextTick();
+
+            if(status == GameStatus::NEXT_NLS || status == GameStatus::PREVIOUS_NLS) {
+                status = ((status == GameStatus::NEXT_NLS) ? GameStatus::NEXT : GameStatus::PREVIOUS);
+            }
+            if(status == GameStatus::NEXT) {
+                Utils::Profiler::Zone zone("Loading");
+                ctrl->loadNextScreen();
+            }
+            if(status == GameStatus::STOP || status == GameStatus::REBOOT) {
+                break;
+            }
+            _changeScreen(status, ctrl);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        Utils::Log::oplog("Headless run over: " + std::to_string(tick) + " ticks in " + std::to_string(elapsed.count()) + "s ("
+                          + std::to_string(tick / elapsed.count()) + " ticks/s)");
+        AGameScreen::renderEnabled = true;
+        Utils::Input::setKeyboardEnabled(true);
+        return GameStatus::STOP;
+    }
+
+    GameStatus GameLoop::_loadNextScreen(AGameScreen *ctrl, Ui::Window &window, sf::Text &loadingTxt) {
+        std::future<void> loading = std::async(std::launch::async, [ctrl]() {
+            ctrl->loadNextScreen();
+        });
+
+        const sf::String loadingStr = loadingTxt.getString();
+        sf::Clock animClock;
+        bool closed = false;
+        while(loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            //Uploads the textures decoded by the loading thread
+            Utils::MainThread::processTasks(std::chrono::milliseconds(LOADING_TASKS_DURATION));
+            //The musics keep fading and starting while loading
+            uidata->getJukebox().update();
+
+            //The window must stay responsive. These events are not given to the screens, so they are not recorded.
+            sf::Event event;
+            while(window.getWindow().pollEvent(event)) {
+                _checkWindowResize(event, window);
+                closed = closed || event.type == sf::Event::Closed;
+            }
+
+            //Loading indicator : from zero to three dots after the text
+            int dots = (animClock.getElapsedTime().asMilliseconds() / 300) % 4;
+            loadingTxt.setString(loadingStr + sf::String(std::string(dots, '.')));
+            window.getFrame().setView(window.getFrame().getDefaultView());
+            window.getFrame().clear(sf::Color(74, 81, 148));
+            window.getFrame().draw(loadingTxt);
+            window.refresh();
+        }
+        loadingTxt.setString(loadingStr);
+        //Throws the exceptions thrown while loading
+        loading.get();
+
+        return closed ? GameStatus::STOP : GameStatus::NEXT;
+    }
+
+    void GameLoop::_changeScreen(GameStatus status, AGameScreen *ctrl) {
+        switch(status) {
+        case GameStatus::NEXT: //Pauses the current screen and passes to the next
+            ctrl->suspend();
+            _gameScreens.push(ctrl->getNextGameScreen());
+            break;
+        case GameStatus::PREVIOUS: //Deletes the current screen and returns to the previous one
+            _gameScreens.pop();
+            _gameScreens.top()->resume();
+            break;
+        default:
+            break;
+        }
+    }
+
     GameStatus GameLoop::_checkQuit(const sf::Event &event) {
-        if(event.type == sf::Event::Closed || sf::Keyboard::isKeyPressed(sf::Keyboard::Escape)) {
+        if(event.type == sf::Event::Closed || Utils::Input::isKeyPressed(sf::Keyboard::Escape)) {
             return GameStatus::STOP;
         }
 
         return GameStatus::CONTINUE;
     }
 
+    void GameLoop::_checkProfilerDump(const sf::Event &event) const {
+        if(event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+            Utils::Profiler::dump(Path::getLogPath() + "profile.json");
+        }
+    }
+
+    void GameLoop::_checkFrameByFrame(const sf::Event &event) {
+        //Uses the events instead of the keyboard state, so the steps are recorded and replayed by Utils::Input
+        if(event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F2) {
+            frameByFrame = true;
+        } else if((event.type == sf::Event::KeyReleased && event.key.code == sf::Keyboard::F2) || event.type == sf::Event::LostFocus) {
+            frameByFrame = false;
+            stepFrame = false;
+        } else if(frameByFrame && event.type == sf::Event::KeyPressed && event.key.code == fbfType) {
+            stepFrame = true;
+        }
+    }
+
     void GameLoop::_checkWindowResize(const sf::Event &event, Ui::Window &window) const {
         if(event.type == sf::Event::Resized) {
             window.updateView();
@@ -23,9 +23,11 @@
 
 namespace sf {
 class Event;
+class Text;
 }  // namespace sf
 
 namespace OpMon {
+class Player;
 namespace Ui {
 class Window;
 }  // namespace Ui
@@ -37,7 +39,7 @@ class Window;
     class GameLoop {
       public:
         GameLoop();
-        ~GameLoop() = default;
+        ~GameLoop();
 
         /*!
          * \brief Launches the loop.
@@ -45,6 +47,16 @@ class Window;
          */
         GameStatus operator()();
 
+        /*!
+         * \brief Runs the game without opening the window, starting in the overworld.
+         * \details Nothing is drawn and the ticks are not paced : they are run as fast as possible. Used to test and time the game logic.
+         * \warning The resources are still loaded in textures, and SFML needs an OpenGL context to create them. On a machine without display,
+         * the game must be run in a virtual one (like Xvfb).
+         * \param ticks The number of ticks to run.
+         * \return GameStatus::STOP
+         */
+        GameStatus runHeadless(unsigned int ticks);
+
         /*!
          * \brief Checks the event to know if the game must be stopped.
          * \param event The event checked.
@@ -59,18 +71,52 @@ class Window;
          */
         void _checkWindowResize(const sf::Event &event, Ui::Window &window) const;
 
+        /*!
+         * \brief Checks the event to know if the profile must be dumped (F4 key), and dumps it in the log directory if it's the case.
+         * \param event The event checked.
+         * \see Utils::Profiler
+         */
+        void _checkProfilerDump(const sf::Event &event) const;
+
+        /*!
+         * \brief Checks the event to enable or disable the frame by frame mode (F2 key), or to pass one tick in this mode.
+         * \param event The event checked.
+         */
+        void _checkFrameByFrame(const sf::Event &event);
+
     private:
+        /*!
+         * \brief Passes to the next screen or goes back to the previous one, according to the status.
+         * \param status GameStatus::NEXT or GameStatus::PREVIOUS. Nothing is done with the other values.
+         * \param ctrl The current screen.
+         */
+        void _changeScreen(GameStatus status, AGameScreen *ctrl);
+
+        /*!
+         * \brief Calls AGameScreen::loadNextScreen in a loading thread, and shows the loading screen meanwhile.
+         * \details The textures loaded by the loading thread are uploaded on the main thread (see Utils::MainThread).
+         * \param ctrl The current screen.
+         * \param window The game window.
+         * \param loadingTxt The text shown on the loading screen.
+         * \return GameStatus::STOP if the window has been closed while loading, GameStatus::NEXT otherwise.
+         */
+        GameStatus _loadNextScreen(AGameScreen *ctrl, Ui::Window &window, sf::Text &loadingTxt);
+
         /*!
          * \brief The pointer containing the UiData object shared in the different data objects.
          */
         std::unique_ptr<UiData> uidata;
+        /*!
+         * \brief The player created in headless mode, since the start scene is skipped.
+         */
+        std::unique_ptr<Player> headlessPlayer;
         /*!
          * \brief The stack of game screens.
          */
         std::stack<std::unique_ptr<AGameScreen>> _gameScreens;
         /*!
          * \brief If `true`, the game executes itself frame by frame.
-         * \details This mode is activated my keeping the F2 key pressed. On release, the mode is disabled. One frame can be passed by pressing the key registered in `fbfType`.
+         * \details This mode is activated my keeping the F2 key pressed. On release, the mode is disabled. One tick can be passed by pressing the key registered in `fbfType`.
          */
         bool frameByFrame = false;
         /*!
@@ -78,9 +124,9 @@ class Window;
          */
         sf::Keyboard::Key fbfType = sf::Keyboard::F3;
         /*!
-         * \brief Checks in the `fbfType` key has been released before passing one more frame.
+         * \brief If `true`, one tick is passed in frame by frame mode.
          */
-        bool hasBeenReleased = true;
+        bool stepFrame = false;
         /*!
          * \brief Counts the number of times a frame has been skipped because of an exception.
          */
@@ -8,6 +8,9 @@
 
 #include <fstream>
 #include <algorithm>
+#include <future>
+#include <map>
+#include <stdexcept>
 #include <utility>
 
 #include "../../utils/OpString.hpp"
@@ -16,8 +19,10 @@
 #include "system/path.hpp"
 #include "../model/evolutions.hpp"
 #include "src/utils/OptionsSave.hpp"
+#include "src/utils/ResourceCache.hpp"
 #include "src/utils/ResourceLoader.hpp"
 #include "src/utils/KeyData.hpp"
+#include "src/utils/threadpool.hpp"
 #include "src/opmon/model/Enums.hpp"
 #include "src/opmon/model/Species.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
@@ -63,22 +68,60 @@ class Evolution;
         jukebox.addMusic("Wild Battle", "audio/music/wildbattle.ogg");
 
         //Loading sounds
-        jukebox.addSound("door", "audio/sounds/door.ogg");
-        jukebox.addSound("shop door", "audio/sounds/shopdoor.ogg");
-        jukebox.addSound("dialog pass", "audio/sounds/dialogChange.ogg");
-        jukebox.addSound("nope", "audio/sounds/nope.ogg");
-        jukebox.addSound("arrow", "audio/sounds/select.ogg");
-        jukebox.addSound("push", "audio/sounds/selectbuttons.ogg");
-        jukebox.addSound("hit", "audio/sounds/hit.ogg");
+        jukebox.addSounds({{"door", "audio/sounds/door.ogg"},
+                           {"shop door", "audio/sounds/shopdoor.ogg"},
+                           {"dialog pass", "audio/sounds/dialogChange.ogg"},
+                           {"nope", "audio/sounds/nope.ogg"},
+                           {"arrow", "audio/sounds/select.ogg"},
+                           {"push", "audio/sounds/selectbuttons.ogg"},
+                           {"hit", "audio/sounds/hit.ogg"}});
+        //The doors can't be opened twice at the same time
+        jukebox.setPolyphony(jukebox.getSound("door"), 1);
+        jukebox.setPolyphony(jukebox.getSound("shop door"), 1);
+
+        //The types sprites are decoded on the thread pool while the OpMons are loaded
+        std::map<Type, std::future<std::shared_ptr<const sf::Texture>>> typesLoading;
+#define LOAD_TYPE(type)                                                 \
+        typesLoading.emplace(Type::type, Utils::ResourceCache::loadTexture(std::string("sprites/battle/types/") + #type + ".png"))
 
-        Utils::ResourceLoader::load(font, "fonts/Default.ttf", true);
+        LOAD_TYPE(BAD);
+        LOAD_TYPE(BUG);
+        LOAD_TYPE(BURNING);
+        LOAD_TYPE(COLD);
+        LOAD_TYPE(DRAGON);
+        LOAD_TYPE(ELECTRON);
+        LOAD_TYPE(FIGHT);
+        LOAD_TYPE(GHOST);
+        LOAD_TYPE(GROUND);
+        LOAD_TYPE(LIQUID);
+        LOAD_TYPE(MAGIC);
+        LOAD_TYPE(MENTAL);
+        LOAD_TYPE(METAL);
+        LOAD_TYPE(MINERAL);
+        LOAD_TYPE(NEUTRAL);
+        LOAD_TYPE(SKY);
+        LOAD_TYPE(TOXIC);
+        LOAD_TYPE(VEGETAL);
+
+#undef LOAD_TYPE
 
-        std::ifstream opmonJsonFile(Path::getResourcePath() + "data/opmon.json");
+        //The OpMon sprites are decoded in the same way
+        //I will use a "for" loop later, I don't use it now to avoid loading errors. I will use it when every sprite will be loaded.
+        Utils::TextureBatch spritesLoading;
+        opSprites.resize(8);
+        spritesLoading.addArray(opSprites[1], "sprites/opmons/1-%d.png", 2);
+        spritesLoading.addArray(opSprites[2], "sprites/opmons/2-%d.png", 2);
+        spritesLoading.addArray(opSprites[4], "sprites/opmons/4-%d.png", 2);
+        spritesLoading.addArray(opSprites[7], "sprites/opmons/7-%d.png", 2);
+
+        font = Utils::ResourceCache::getFont("fonts/Default.ttf", true);
+
+        std::unique_ptr<std::istream> opmonJsonFile = Utils::ResourceLoader::openFile("data/opmon.json");
         if(!opmonJsonFile) {
             throw Utils::LoadingException(Path::getResourcePath() + "data/opmon.json", true);
         }
         nlohmann::json opmonJson;
-        opmonJsonFile >> opmonJson;
+        *opmonJsonFile >> opmonJson;
 
         for(auto itor = opmonJson.begin(); itor != opmonJson.end(); ++itor) {
             int opDexNumber = itor->at("opDex");
@@ -117,51 +160,17 @@ class Evolution;
         }
 
         //Initializating OpMon Sprites
-
-        //I will use a "for" loop later, I don't use it now to avoid loading errors. I will use it when every sprite will be loaded.
-        opSprites.push_back(std::vector<sf::Texture>());
-        opSprites.push_back(std::vector<sf::Texture>());
-        Utils::ResourceLoader::loadTextureArray(opSprites[1], "sprites/opmons/1-%d.png", 2);
-        opSprites.push_back(std::vector<sf::Texture>());
-        Utils::ResourceLoader::loadTextureArray(opSprites[2], "sprites/opmons/2-%d.png", 2);
-        opSprites.push_back(std::vector<sf::Texture>());
-        opSprites.push_back(std::vector<sf::Texture>());
-        Utils::ResourceLoader::loadTextureArray(opSprites[4], "sprites/opmons/4-%d.png", 2);
-        opSprites.push_back(std::vector<sf::Texture>());
-        opSprites.push_back(std::vector<sf::Texture>());
-        opSprites.push_back(std::vector<sf::Texture>());
-        Utils::ResourceLoader::loadTextureArray(opSprites[7], "sprites/opmons/7-%d.png", 2);
+        spritesLoading.wait();
 
         //Intializing types sprites
-#define LOAD_TYPE(type)                                                 \
-        Utils::ResourceLoader::load(tempTx, (std::string("sprites/battle/types/") + #type + ".png").c_str()); \
-        typesTextures.emplace(Type::type, sf::Texture(tempTx))
-
-        sf::Texture tempTx;
-        LOAD_TYPE(BAD);
-        LOAD_TYPE(BUG);
-        LOAD_TYPE(BURNING);
-        LOAD_TYPE(COLD);
-        LOAD_TYPE(DRAGON);
-        LOAD_TYPE(ELECTRON);
-        LOAD_TYPE(FIGHT);
-        LOAD_TYPE(GHOST);
-        LOAD_TYPE(GROUND);
-        LOAD_TYPE(LIQUID);
-        LOAD_TYPE(MAGIC);
-        LOAD_TYPE(MENTAL);
-        LOAD_TYPE(METAL);
-        LOAD_TYPE(MINERAL);
-        LOAD_TYPE(NEUTRAL);
-        LOAD_TYPE(SKY);
-        LOAD_TYPE(TOXIC);
-        LOAD_TYPE(VEGETAL);
-
-#undef LOAD_TYPE
+        for(auto &type : typesLoading) {
+            typesTextures.emplace(type.first, Utils::ThreadPool::wait(type.second));
+        }
+        typesTextures.emplace(Type::NOTHING, std::make_shared<const sf::Texture>());
 
         //Loading dialogs
-        Utils::ResourceLoader::load(menuFrame, "backgrounds/menuframe.png");
-        Utils::ResourceLoader::load(dialogArrow, "sprites/misc/arrDial.png");
+        menuFrame = Utils::ResourceCache::getTexture("backgrounds/menuframe.png");
+        dialogArrow = Utils::ResourceCache::getTexture("sprites/misc/arrDial.png");
 
         //Loading volume
         if(!options->checkParam("volume")) {
@@ -171,6 +180,21 @@ class Evolution;
         int volume = std::stoi(options->getParam("volume").getValue());
         jukebox.setGlobalVolume(volume);
 
+        //Loading the duration of the crossfade between the musics, in milliseconds
+        if(!options->checkParam("music.fade")) {
+        	options->addParam("music.fade", std::to_string(JUKEBOX_FADE_DURATION));
+        }
+        try {
+            int fade = std::stoi(options->getParam("music.fade").getValue());
+            if(fade < 0) {
+                throw std::out_of_range("music.fade");
+            }
+            jukebox.setFadeDuration(sf::milliseconds(fade));
+        } catch(std::exception &) {
+            Utils::Log::warn("Invalid music.fade option, using the default value.");
+            jukebox.setFadeDuration(sf::milliseconds(JUKEBOX_FADE_DURATION));
+        }
+
         std::string keyUp = options->getParam("control.up").getValue();
         if(keyUp == "NULL") {
         	options->addParam("control.up", "Up");
@@ -10,6 +10,7 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <ext/alloc_traits.h>
 #include <map>
+#include <string_view>
 
 #include "../view/ui/Jukebox.hpp"
 #include "../view/ui/Window.hpp"
@@ -32,13 +33,13 @@ class Species;
         std::vector<std::vector<sf::Texture>> opSprites;
         std::map<unsigned int, Species *> listOp;
         std::vector<std::map<int, std::string>> atkOpLvl;
-        std::unordered_map<Type, sf::Texture> typesTextures;
+        std::unordered_map<Type, std::shared_ptr<const sf::Texture>> typesTextures;
 
-        sf::Texture dialogArrow;
+        std::shared_ptr<const sf::Texture> dialogArrow;
         sf::Texture dialogBackground;
 
         Ui::Jukebox jukebox;
-        sf::Font font;
+        std::shared_ptr<const sf::Font> font;
 
         sf::Keyboard::Key up;
         sf::Keyboard::Key down;
@@ -50,7 +51,7 @@ class Species;
         uint32_t windowHeight = 540;
         uint32_t windowWidth = 960;
 
-        sf::Texture menuFrame;
+        std::shared_ptr<const sf::Texture> menuFrame;
 
         Utils::OptionsSave *options;
 
@@ -67,7 +68,7 @@ class Species;
         /*!
          * \brief Gets a reference to the game's font.
          */
-        sf::Font const &getFont() const { return font; }
+        sf::Font const &getFont() const { return *font; }
         UiData();
         ~UiData();
         /*!
@@ -81,14 +82,17 @@ class Species;
          */
         Species *getOp(unsigned int id) { return listOp.at(id); }
         /*!
-         * \brief Gets the texture of a type.
+         * \brief Gets the texture of a type, or an empty texture if the type has none.
          */
-        sf::Texture &getTypeTexture(Type type) { return typesTextures[type]; }
+        sf::Texture const &getTypeTexture(Type type) {
+            auto itor = typesTextures.find(type);
+            return *(itor != typesTextures.end() ? itor->second : typesTextures.at(Type::NOTHING));
+        }
 
         /*!
          * \brief Gets the texture of the dialog arrow.
          */
-        sf::Texture &getDialogArrow() { return dialogArrow; }
+        sf::Texture const &getDialogArrow() { return *dialogArrow; }
         /*!
          * \brief Gets the background texture of the dialog box.
          */
@@ -129,7 +133,7 @@ class Species;
          */
         uint32_t getWindowWidth() const { return windowWidth; }
 
-        sf::Texture &getMenuFrame() { return menuFrame; }
+        std::shared_ptr<const sf::Texture> getMenuFrame() { return menuFrame; }
 
         /*!
          * \brief Sets the key for the "up" action.
@@ -153,7 +157,8 @@ class Species;
          */
         void setKeyTalk(const std::string talkName) { talk = Utils::KeyData::keysMap.at(talkName); }
 
-        sf::String getString(std::string key) {return Utils::I18n::Translator::getInstance().getStringKeys().get(key);}
+        sf::String getString(std::string_view key) {return Utils::I18n::Translator::getInstance().getStringKeys().get(key);}
+        sf::String getString(Utils::KeyId key) {return Utils::I18n::Translator::getInstance().getStringKeys().get(key);}
 
         Utils::StringKeys& getStringKeys() {return Utils::I18n::Translator::getInstance().getStringKeys();}
 
@@ -5,9 +5,11 @@ Contributors : Stelyus, Navet56
 File under GNU GPL v3.0 license
 */
 #include <ctime>
+#include <filesystem>
 #include <string>
 #include <iostream>
 #include <map>
+#include <vector>
 
 #include "../../utils/defines.hpp"
 #include "../../utils/fs.hpp"
@@ -15,9 +17,13 @@ File under GNU GPL v3.0 license
 #include "system/path.hpp"
 #include "../../utils/time.hpp"
 #include "src/utils/OptionsSave.hpp"
+#include "src/utils/ResourceArchive.hpp"
 #include "src/utils/ResourceLoader.hpp"
 #include "Gameloop.hpp"
 #include "src/utils/i18n/Translator.hpp"
+#include "src/utils/profiler.hpp"
+#include "src/utils/input.hpp"
+#include "src/opmon/view/elements/MapPack.hpp"
 #include "config.hpp"
 
 using Utils::Log::oplog;
@@ -46,6 +52,53 @@ namespace OpMon {
 
         std::string versionS;
 
+        /*!
+         * \brief If `true`, the profile is written in the log directory when the game ends.
+         */
+        bool profile = false;
+
+        /*!
+         * \brief If not 0, the game runs in headless mode for this number of ticks.
+         * \see GameLoop::runHeadless
+         */
+        unsigned int headlessTicks = 0;
+
+        /*!
+         * \brief The input log to write (--record) or to read (--replay). Empty if none.
+         */
+        std::string recordPath;
+        std::string replayPath;
+
+        /*!
+         * \brief If `true`, `data/maps.json` is compiled in `data/maps.pack` instead of starting the game.
+         * \see Elements::MapPack
+         */
+        bool compileMaps = false;
+
+        /*!
+         * \brief If `true`, the resource folder is packed in `resources.pack` instead of starting the game.
+         * \see Utils::ResourceArchive
+         */
+        bool packResources = false;
+
+        /*!
+         * \brief If `true`, the resources are read from the resource folder even if `resources.pack` exists.
+         */
+        bool looseFiles = false;
+
+        /*!
+         * \brief If `true`, `resources.pack` is only used if it contains the current files of the resource folder.
+         * \details Used during the development, since the whole resource folder is listed. A shipped archive is trusted as it is.
+         * \see Utils::ResourceArchive::isUpToDate
+         */
+        bool checkResources = false;
+
+        /*!
+         * \brief The files of the resource folder which aren't put in `resources.pack`.
+         * \details The maps are read from `data/maps.pack`, or from `data/maps.json`, which are memory mapped.
+         */
+        const std::vector<std::string> unpackedFiles = {"data/maps.json", "data/maps.pack"};
+
         int starts() {
 
             Utils::Log::init(Path::getLogPath());
@@ -70,10 +123,60 @@ namespace OpMon {
                 return -1;
             }
 
+            if(compileMaps) {
+                try {
+                    Elements::MapPack::compile(Path::getResourcePath() + "data/maps.json", Path::getResourcePath() + "data/maps.pack");
+                } catch(Utils::Exception &e) {
+                    oplog("Unable to compile the maps: " + e.desc(), true);
+                    return e.returnId;
+                }
+                oplog("End of the program. Return 0");
+                return 0;
+            }
+
+            if(packResources) {
+                try {
+                    Utils::ResourceArchive::pack(Path::getResourcePath(), Path::getResourcePath() + "resources.pack", unpackedFiles);
+                } catch(Utils::Exception &e) {
+                    oplog("Unable to pack the resources: " + e.desc(), true);
+                    return e.returnId;
+                }
+                oplog("End of the program. Return 0");
+                return 0;
+            }
+
+            //The files missing from the archive are still read from the resource folder
+            std::string archivePath = Path::getResourcePath() + "resources.pack";
+            std::error_code error;
+            if(!looseFiles && std::filesystem::exists(archivePath, error)) {
+                if(checkResources && !Utils::ResourceArchive::isUpToDate(Path::getResourcePath(), archivePath, unpackedFiles)) {
+                    Utils::Log::warn("resources.pack doesn't match the resource folder, and won't be used. Pack it again with --pack-resources.");
+                } else if(Utils::ResourceLoader::openArchive(archivePath)) {
+                    oplog("Reading the resources from resources.pack");
+                }
+            }
+
             oplog("Loading completed! Opening gui.");
 
             bool reboot = false;
             try{
+                //The headless mode starts in the overworld instead of the main menu
+                Utils::Input::StartMode start = (headlessTicks != 0) ? Utils::Input::StartMode::OVERWORLD : Utils::Input::StartMode::MAIN_MENU;
+                if(!replayPath.empty()) {
+                    Utils::Input::startReplay(replayPath, start);
+                } else if(!recordPath.empty()) {
+                    Utils::Input::startRecording(recordPath, start);
+                }
+                if(headlessTicks != 0) {
+                    GameLoop gameloop;
+                    gameloop.runHeadless(headlessTicks);
+                    if(profile) {
+                        Utils::Profiler::dump(Path::getLogPath() + "profile.json");
+                    }
+                    Utils::Input::stop();
+                    oplog("End of the program. Return 0");
+                    return 0;
+                }
                 do {
                     oplog("Starting game loop");
 
@@ -88,6 +191,10 @@ namespace OpMon {
                         oplog("Restarting the game.");
                     }
                 } while(reboot);
+                if(profile) {
+                    Utils::Profiler::dump(Path::getLogPath() + "profile.json");
+                }
+                Utils::Input::stop();
                 oplog("Ending the game normally.");
                 oplog("End of the program. Return 0");
                 return 0;
@@ -122,7 +229,32 @@ int main(int argc, char *argv[]) {
             } else if(str == "--help") {
                 std::cout << "--version : Prints the version and quit." << std::endl;
                 std::cout << "--help : Prints this message and quit." << std::endl;
+                std::cout << "--headless [ticks] : Runs the given number of ticks (10000 by default) in the overworld without opening the window, then quits. A display is still needed to create the textures (use Xvfb on a machine without display)." << std::endl;
+                std::cout << "--record <file> : Records the inputs and the random seed in the file." << std::endl;
+                std::cout << "--replay <file> : Replays the inputs recorded with --record, then quits." << std::endl;
+                std::cout << "--compile-maps : Compiles data/maps.json in data/maps.pack, which is faster to load, and quits." << std::endl;
+                std::cout << "--pack-resources : Packs the resource folder in resources.pack, which is faster to load, and quits." << std::endl;
+                std::cout << "--loose-files : Reads the resources from the resource folder, even if resources.pack exists." << std::endl;
+                std::cout << "--check-resources : Reads the resources from the resource folder if resources.pack doesn't match it. Slower to start, for the development." << std::endl;
+                std::cout << "--profile : Writes the frame profile (profile.json) in the log directory when the game ends. F4 writes it at any time." << std::endl;
                 return 0;
+            } else if(str == "--compile-maps") {
+                OpMon::Main::compileMaps = true;
+            } else if(str == "--pack-resources") {
+                OpMon::Main::packResources = true;
+            } else if(str == "--loose-files") {
+                OpMon::Main::looseFiles = true;
+            } else if(str == "--check-resources") {
+                OpMon::Main::checkResources = true;
+            } else if(str == "--profile") {
+                OpMon::Main::profile = true;
+            } else if((str == "--record" || str == "--replay") && i + 1 < argc) {
+                (str == "--record" ? OpMon::Main::recordPath : OpMon::Main::replayPath) = argv[++i];
+            } else if(str == "--headless") {
+                OpMon::Main::headlessTicks = 10000;
+                if(i + 1 < argc && argv[i + 1][0] != '\0' && std::string(argv[i + 1]).find_first_not_of("0123456789") == std::string::npos) {
+                    OpMon::Main::headlessTicks = std::stoul(argv[++i]);
+                }
             }
         }
     }
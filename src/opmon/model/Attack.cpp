@@ -23,6 +23,7 @@
 #include "src/opmon/view/ui/Elements.hpp"
 #include "src/utils/OpString.hpp"
 #include "src/utils/misc.hpp"
+#include "src/utils/ResourceLoader.hpp"
 
 namespace OpMon {
 
@@ -38,10 +39,13 @@ namespace OpMon {
     }
 
     void Attack::initAttacks(std::string file) {
-        std::ifstream jsonStream(file);
+        std::unique_ptr<std::istream> jsonStream = Utils::ResourceLoader::openFile(file);
+        if(!jsonStream) {
+            throw Utils::LoadingException(file, true);
+        }
         nlohmann::json json;
 
-        jsonStream >> json;
+        *jsonStream >> json;
 
         for(auto itor = json.begin(); itor != json.end(); ++itor) {
             std::string idStr = itor->at("id");
@@ -85,7 +85,7 @@ class Attack;
         static Attack *newAtk(std::string name);
         /*!
          * \brief Initialises the attacks and stores them in Attack::attackList.
-         * \param file The file containing the data to load (Json format).
+         * \param file The file containing the data to load (Json format), relative to the resource folder.
          */
         static void initAttacks(std::string file);
 
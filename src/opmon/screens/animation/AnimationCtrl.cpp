@@ -16,7 +16,9 @@ namespace OpMon {
 
     GameStatus AnimationCtrl::update(sf::RenderTexture &frame) {
         GameStatus status = view->update();
-        frame.draw(*view);
+        if(renderEnabled) {
+            frame.draw(*view);
+        }
         return status;
     }
 } // namespace OpMon
@@ -10,35 +10,26 @@
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 
-#include "src/utils/ResourceLoader.hpp"
 #include "src/opmon/core/GameStatus.hpp"
 
 namespace OpMon {
 
     namespace Animations {
 
-        //While false, the "WinAnim" animation's sprites are not loaded
-        bool WinAnim::winInit = false;
-        //Array used by "WinAnim"
-        sf::Texture WinAnim::fen[6];
-
-        Animation::Animation(sf::Texture bgTxt, sf::Texture after)
-            : bgTxt(bgTxt)
-            , afterTx(after) {
+        Animation::Animation(std::shared_ptr<const sf::Texture> bgTxt, std::shared_ptr<const sf::Texture> after)
+            : bgTxt(std::move(bgTxt))
+            , afterTx(std::move(after)) {
         }
 
-        WinAnim::WinAnim(sf::Texture const& bgTxt, bool order)
-            : Animation(bgTxt)
-            , order(order) {
-            if(!winInit) {
-                winInit = true;
-                Utils::ResourceLoader::loadTextureArray(fen, "animations/winChange/animWindowFrame%d.png", 6, 1);
-            }
+        WinAnim::WinAnim(std::shared_ptr<const sf::Texture> bgTxt, bool order, std::array<std::shared_ptr<const sf::Texture>, 6> const &fen)
+            : Animation(std::move(bgTxt))
+            , order(order)
+            , fen(fen) {
         }
 
         GameStatus WinAnim::update(){
-            bgSpr.setTexture(bgTxt);
-            anim.setTexture(fen[(order ? counter : (frames - counter))]);
+            bgSpr.setTexture(*bgTxt);
+            anim.setTexture(*fen[(order ? counter : (frames - counter))]);
             counter++;
             return (counter > frames) ? GameStatus::PREVIOUS_NLS : GameStatus::CONTINUE;
         }
@@ -48,8 +39,8 @@ namespace OpMon {
             frame.draw(anim);
         }
 
-        WooshAnim::WooshAnim(sf::Texture const& before, sf::Texture const& after, WooshDir dir, int duration, bool outToIn)
-            : Animation(before, after)
+        WooshAnim::WooshAnim(std::shared_ptr<const sf::Texture> before, std::shared_ptr<const sf::Texture> after, WooshDir dir, int duration, bool outToIn)
+            : Animation(std::move(before), std::move(after))
             , dir(dir)
             , duration(duration)
             , outToIn(outToIn) {
@@ -69,9 +60,9 @@ namespace OpMon {
             mvDir[(int)WooshDir::LEFT] = sf::Vector2f(-1, 0);
 
             this->bgSpr.setPosition(0, 0);
-            this->bgSpr.setTexture(before);
+            this->bgSpr.setTexture(*bgTxt);
 
-            this->anim.setTexture(after);
+            this->anim.setTexture(*afterTx);
             this->anim.setPosition(initialPos[(int)dir]);
         }
 
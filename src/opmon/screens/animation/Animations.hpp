@@ -15,7 +15,9 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <array>
 #include <iostream>
+#include <memory>
 
 #include "src/opmon/core/GameStatus.hpp"
 #include "src/utils/defines.hpp"
@@ -47,11 +49,11 @@ namespace OpMon {
             /*!
              * \brief The texture of the background.
              */
-            sf::Texture bgTxt;
+            std::shared_ptr<const sf::Texture> bgTxt;
             /*!
-             * \brief The texture to show after the animation.
+             * \brief The texture to show after the animation. Can be `nullptr`.
              */
-            sf::Texture afterTx;
+            std::shared_ptr<const sf::Texture> afterTx;
 
         public:
             /*!
@@ -60,7 +62,7 @@ namespace OpMon {
              * \param after The texture to show after the animation.
              * \details For classic animations, "before" is enough. "after" is used for transitions.
              */
-            Animation(sf::Texture before, sf::Texture after = sf::Texture());
+            Animation(std::shared_ptr<const sf::Texture> before, std::shared_ptr<const sf::Texture> after = nullptr);
             virtual ~Animation() = default;
             virtual GameStatus update() = 0;
             /*!
@@ -82,16 +84,17 @@ namespace OpMon {
              */
             bool order;
             /*!
-             * \brief If `true`, the textures for the animation has been loaded.
+             * \brief The textures for the animation, kept loaded by StartSceneData.
              */
-            static bool winInit;
-            /*!
-             * \brief The textures for the animation.
-             */
-            static sf::Texture fen[6];
+            std::array<std::shared_ptr<const sf::Texture>, 6> fen;
 
         public:
-            WinAnim(sf::Texture const& bgTxt, bool order);
+            /*!
+             * \param bgTxt The texture displayed behind the window.
+             * \param order `true` for the opening movement, `false` for the closing movement.
+             * \param fen The frames of the window (see StartSceneData::getWindowFrames).
+             */
+            WinAnim(std::shared_ptr<const sf::Texture> bgTxt, bool order, std::array<std::shared_ptr<const sf::Texture>, 6> const &fen);
             virtual GameStatus update() override;
             void draw(sf::RenderTarget& frame, sf::RenderStates state) const;
         };
@@ -145,7 +148,7 @@ namespace OpMon {
              * \param duraction The duration of the movement, in frames.
              * \param outToIn The initial position of the mobile sprite.
              */
-            WooshAnim(sf::Texture const& before, sf::Texture const& after, WooshDir dir, int duration = 15, bool outToIn = true);
+            WooshAnim(std::shared_ptr<const sf::Texture> before, std::shared_ptr<const sf::Texture> after, WooshDir dir, int duration = 15, bool outToIn = true);
 
             GameStatus update();
             void draw(sf::RenderTarget& frame, sf::RenderStates state) const;
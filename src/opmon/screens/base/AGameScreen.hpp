@@ -23,8 +23,10 @@ namespace OpMon {
      * \brief Interface of all first-level controllers.
      *
      * A game screen is handled by the GameLoop.
-     * When running, two methods are called: processEvent() is called for each sf::Event detected, then update() is
-     * called once per frame.
+     * When running, three methods are called: checkEvent() is called for each sf::Event detected, update() is called
+     * once per simulation tick, and draw() is called once per displayed frame.
+     * The ticks have a fixed duration, independent from the display rate : a frame can be drawn after zero, one or
+     * several ticks.
      *
      * In addition, suspend() and resume() are called when respectively the controller loose the focus (another
      * controller is added on top) and regain the focus.
@@ -40,12 +42,20 @@ namespace OpMon {
         virtual GameStatus checkEvent(sf::Event const &) { return GameStatus::CONTINUE; }
 
         /*!
-         * \brief Updates and draws the game.
+         * \brief Updates the game by one simulation tick.
          *
-         * This method is called once per frame.
+         * This method is called at a fixed rate. Screens which don't override draw() also draw themselves in the frame here.
          */
         virtual GameStatus update(sf::RenderTexture &frame) = 0;
 
+        /*!
+         * \brief Draws the game between two ticks.
+         * \param frame The frame to draw in.
+         * \param interpolation The time elapsed since the last tick, as a fraction of a tick (between 0 and 1). Used to smooth the movements.
+         * \details This method is called once per displayed frame. By default, it does nothing and the frame drawn in update() is shown again.
+         */
+        virtual void draw(sf::RenderTexture &/*frame*/, float /*interpolation*/){};
+
         virtual void suspend(){};
         virtual void resume(){};
 
@@ -57,6 +67,12 @@ namespace OpMon {
 
         std::unique_ptr<AGameScreen> getNextGameScreen() { return std::move(_next_gs); };
 
+        /*!
+         * \brief If `false`, the screens must not draw anything in the frame.
+         * \details Disabled in headless mode, where the frame given to update() is never created nor shown.
+         */
+        static inline bool renderEnabled = true;
+
     protected:
         /*!
          * \brief The next screen, loaded after loadNextScreen has been called.
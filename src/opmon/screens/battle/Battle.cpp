@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "src/utils/StringKeys.hpp"
+#include "src/utils/profiler.hpp"
 #include "src/opmon/model/Attack.hpp"
 #include "BattleData.hpp"
 #include "src/opmon/core/Player.hpp"
@@ -110,6 +111,7 @@ namespace OpMon {
     }
 
     GameStatus Battle::update(Elements::TurnData const &atkTurn, Elements::TurnData const &defTurn, std::queue<Elements::TurnAction> &actionQueue, bool *turnActivated, bool atkFirst) {
+        Utils::Profiler::Zone zone("Battle::update");
 
         drawDialog = false;
         drawMainDialog = false;
@@ -172,7 +174,7 @@ namespace OpMon {
                         }
                     }
                 } else if(turnAct.type == Elements::TurnActionType::ATK_UPDATE_HBAR || turnAct.type == Elements::TurnActionType::DEF_UPDATE_HBAR) { //Updates the player's OpMon's healthbar.
-                    data.getUiDataPtr()->getJukebox().playSound("hit");
+                    data.getUiDataPtr()->getJukebox().playSound(hitSound);
                     auto &opmonHp = (turnAct.type == Elements::TurnActionType::ATK_UPDATE_HBAR) ? atkHp : defHp;
                     opmonHp -= turnAct.hpLost;
                     opmonHp = (opmonHp < 0) ? 0 : opmonHp; //Don't drop below 0
@@ -356,12 +358,13 @@ namespace OpMon {
     Battle::Battle(const OpTeam *atkTeam, const OpTeam *defTeam, std::string trainerClass, std::string background, BattleData &data)
         : atkTeam(atkTeam)
         , defTeam(defTeam)
-        , data(data) {
+        , data(data)
+        , hitSound(data.getUiDataPtr()->getJukebox().getSound("hit")) {
         this->background.setTexture(data.getBackground(background));
-        playerSpr.setTexture(data.getCharaBattleTextures("player")[0]);
+        playerSpr.setTexture(*data.getCharaBattleTextures("player")[0]);
         playerSpr.setPosition(20, 218);
         playerSpr.setScale(2, 2);
-        trainerSpr.setTexture(data.getCharaBattleTextures(trainerClass)[0]);
+        trainerSpr.setTexture(*data.getCharaBattleTextures(trainerClass)[0]);
         trainerSpr.setPosition(400, 20);
 
         choicesTxt[0].setString(data.getUiDataPtr()->getString("battle.attack"));
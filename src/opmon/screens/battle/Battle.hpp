@@ -191,6 +191,11 @@ class Transformation;
 
         BattleData &data;
 
+        /*!
+         * \brief The sound played when an OpMon is hit.
+         */
+        Ui::SoundId hitSound;
+
         bool dialogOver = true;
 
         /*!
@@ -42,14 +42,18 @@ class Species;
         , trainerTeam(two)
         , atk(one->getOp(0))
         , def(two->getOp(0))
-        , view(one, two, "beta", "grass", this->data) {
+        , view(one, two, "beta", "grass", this->data)
+        , arrowSound(uidata->getJukebox().getSound("arrow"))
+        , nopeSound(uidata->getJukebox().getSound("nope")) {
         initBattle(0, 0);
         next.type = Elements::TurnActionType::NEXT;
     }
 
     GameStatus BattleCtrl::update(sf::RenderTexture &frame) {
         GameStatus returned = view.update(atkTurn, defTurn, actionsQueue, &turnActivated, atkFirst);
-        frame.draw(view);
+        if(renderEnabled) {
+            frame.draw(view);
+        }
         return returned;
     }
 
@@ -61,18 +65,18 @@ class Species;
                 //Selection events
             case sf::Keyboard::Left:
                 view.moveCur(Side::TO_LEFT);
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                 break;
             case sf::Keyboard::Right:
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                 view.moveCur(Side::TO_RIGHT);
                 break;
             case sf::Keyboard::Up:
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                 view.moveCur(Side::TO_UP);
                 break;
             case sf::Keyboard::Down:
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                 view.moveCur(Side::TO_DOWN);
                 break;
             case sf::Keyboard::Return:
@@ -86,7 +90,7 @@ class Species;
                         /*case 3:
                           return GameStatus::PREVIOUS; //Run*/
                     default:
-                        data.getUiDataPtr()->getJukebox().playSound("nope");
+                        data.getUiDataPtr()->getJukebox().playSound(nopeSound);
                         break;
                     }
 
@@ -101,7 +105,7 @@ class Species;
                             turnActivated = true;
                         }
                     } else { //The attack is invalid
-                        data.getUiDataPtr()->getJukebox().playSound("nope");
+                        data.getUiDataPtr()->getJukebox().playSound(nopeSound);
                     }
                 } else if(turnActivated) {
                     view.passDialog();
@@ -8,6 +8,7 @@
 #include "src/opmon/model/Attack.hpp"
 #include "Battle.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/view/ui/Jukebox.hpp"
 
 namespace sf {
 class Event;
@@ -151,6 +152,12 @@ namespace Elements {
          */
         Elements::TurnAction next;
 
+        /*!
+         * \brief The sounds played when choosing the actions.
+         */
+        Ui::SoundId arrowSound;
+        Ui::SoundId nopeSound;
+
     public:
         virtual ~BattleCtrl() = default;
         /*!
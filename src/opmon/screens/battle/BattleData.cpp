@@ -5,7 +5,7 @@
 */
 #include "BattleData.hpp"
 
-#include "src/utils/ResourceLoader.hpp"
+#include "src/utils/ResourceCache.hpp"
 
 namespace OpMon {
 class Player;
@@ -14,26 +14,24 @@ class UiData;
     BattleData::BattleData(UiData *data, Player *player)
         : uidata(data)
         , player(player) {
-        Utils::ResourceLoader::load(backgrounds["grass"], "backgrounds/battle_bkg/background_grass.png");
-        Utils::ResourceLoader::load(dialog, "backgrounds/dialog/battle_dialog.png");
+        backgrounds["grass"] = Utils::ResourceCache::getTexture("backgrounds/battle_bkg/background_grass.png");
+        dialog = Utils::ResourceCache::getTexture("backgrounds/dialog/battle_dialog.png");
 
-        Utils::ResourceLoader::load(cursor, "sprites/misc/arrBattle.png");
+        cursor = Utils::ResourceCache::getTexture("sprites/misc/arrBattle.png");
 
-        charaBattleTextures["player"].push_back(sf::Texture());
-        Utils::ResourceLoader::load(charaBattleTextures["player"][0], "sprites/chara/pp/pp_battle.png");
+        charaBattleTextures["player"].push_back(Utils::ResourceCache::getTexture("sprites/chara/pp/pp_battle.png"));
         //charaBattleTextures["cyrielle"].push_back(sf::Texture());
         //Utils::ResourceLoader::load(charaBattleTextures["cyrielle"][0], "sprites/chara/cyrielle/cyrielle_battle.png");
-        charaBattleTextures["beta"].push_back(sf::Texture());
-        Utils::ResourceLoader::load(charaBattleTextures["beta"][0], "sprites/chara/beta/beta_battle.png");
+        charaBattleTextures["beta"].push_back(Utils::ResourceCache::getTexture("sprites/chara/beta/beta_battle.png"));
         battlePlayerAnim.push_back(charaBattleTextures["player"][0]);
-        Utils::ResourceLoader::load(infoboxPlayer, "sprites/battle/square_1.png");
-        Utils::ResourceLoader::load(infoboxTrainer, "sprites/battle/square_2.png");
-        Utils::ResourceLoader::load(healthbar1, "sprites/battle/health_bar.png");
-        Utils::ResourceLoader::load(healthbar2, "sprites/battle/health_jauge.png");
-        Utils::ResourceLoader::load(shadowPlayer, "sprites/battle/shadow_2.png");
-        Utils::ResourceLoader::load(shadowTrainer, "sprites/battle/shadow_1.png");
+        infoboxPlayer = Utils::ResourceCache::getTexture("sprites/battle/square_1.png");
+        infoboxTrainer = Utils::ResourceCache::getTexture("sprites/battle/square_2.png");
+        healthbar1 = Utils::ResourceCache::getTexture("sprites/battle/health_bar.png");
+        healthbar2 = Utils::ResourceCache::getTexture("sprites/battle/health_jauge.png");
+        shadowPlayer = Utils::ResourceCache::getTexture("sprites/battle/shadow_2.png");
+        shadowTrainer = Utils::ResourceCache::getTexture("sprites/battle/shadow_1.png");
 
-        Utils::ResourceLoader::load(attackDialog, "backgrounds/dialog/attacks_dialog.png");
+        attackDialog = Utils::ResourceCache::getTexture("backgrounds/dialog/attacks_dialog.png");
     }
 
 } // namespace OpMon
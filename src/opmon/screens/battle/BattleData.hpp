@@ -6,6 +6,7 @@
 #pragma once
 
 #include <list>
+#include <memory>
 
 #include "src/opmon/core/Player.hpp"
 #include "src/opmon/core/UiData.hpp"
@@ -19,19 +20,23 @@ class UiData;
      */
     class BattleData {
     private:
-        std::map<std::string, sf::Texture> backgrounds;
-        sf::Texture dialog;
-        sf::Texture attackDialog;
-        sf::Texture cursor;
+        std::map<std::string, std::shared_ptr<const sf::Texture>> backgrounds;
+        std::shared_ptr<const sf::Texture> dialog;
+        std::shared_ptr<const sf::Texture> attackDialog;
+        std::shared_ptr<const sf::Texture> cursor;
         //std::vector<sf::Texture> choices;
-        std::map<std::string, std::vector<sf::Texture>> charaBattleTextures;
-        std::list<sf::Texture> battlePlayerAnim;
-        sf::Texture infoboxPlayer;
-        sf::Texture infoboxTrainer;
-        sf::Texture shadowPlayer;
-        sf::Texture shadowTrainer;
-        sf::Texture healthbar1;
-        sf::Texture healthbar2;
+        std::map<std::string, std::vector<std::shared_ptr<const sf::Texture>>> charaBattleTextures;
+        std::list<std::shared_ptr<const sf::Texture>> battlePlayerAnim;
+        std::shared_ptr<const sf::Texture> infoboxPlayer;
+        std::shared_ptr<const sf::Texture> infoboxTrainer;
+        std::shared_ptr<const sf::Texture> shadowPlayer;
+        std::shared_ptr<const sf::Texture> shadowTrainer;
+        std::shared_ptr<const sf::Texture> healthbar1;
+        std::shared_ptr<const sf::Texture> healthbar2;
+        /*!
+         * \brief Returned for the unknown backgrounds.
+         */
+        sf::Texture emptyTexture;
 
         UiData *uidata;
         Player *player;
@@ -68,52 +73,55 @@ class UiData;
          * \param id The identifier of the wanted background.
          * \returns The background associated to the identifier, an empty sf::Texture if not found.
          */
-        sf::Texture &getBackground(std::string id) { return backgrounds[id]; }
+        sf::Texture const &getBackground(std::string id) {
+            auto itor = backgrounds.find(id);
+            return itor == backgrounds.end() ? emptyTexture : *itor->second;
+        }
         /*!
          * \brief Gets the texture of the action choice dialog.
          */
-        sf::Texture &getDialog() { return dialog; }
+        sf::Texture const &getDialog() { return *dialog; }
         /*!
          * \brief Gets the texture of the attack choice dialog.
          */
-        sf::Texture &getAttackDialog() { return attackDialog; }
+        sf::Texture const &getAttackDialog() { return *attackDialog; }
         /*!
          * \brief Gets the texture of the cursor.
          */
-        sf::Texture &getCursor() { return cursor; }
+        sf::Texture const &getCursor() { return *cursor; }
         /*!
          * \brief Gets the character's battle textures.
          * \param id The identifier of the character's textures.
          */
-        std::vector<sf::Texture> &getCharaBattleTextures(std::string id) { return charaBattleTextures[id]; }
+        std::vector<std::shared_ptr<const sf::Texture>> &getCharaBattleTextures(std::string id) { return charaBattleTextures[id]; }
         /*!
          * \brief Gets the iterator to the first element of the list of textures for the player's sprite animation at the start of a battle.
          */
-        std::list<sf::Texture>::iterator getBattlePlayerAnimBegin() { return battlePlayerAnim.begin(); }
+        std::list<std::shared_ptr<const sf::Texture>>::iterator getBattlePlayerAnimBegin() { return battlePlayerAnim.begin(); }
         /*!
          * \brief Gets the texture of the infobox for the player's OpMon.
          */
-        sf::Texture &getInfoboxPlayer() { return infoboxPlayer; }
+        sf::Texture const &getInfoboxPlayer() { return *infoboxPlayer; }
         /*!
          * \brief Gets the texture of the infobox for the opponent's OpMon.
          */
-        sf::Texture &getInfoboxTrainer() { return infoboxTrainer; }
+        sf::Texture const &getInfoboxTrainer() { return *infoboxTrainer; }
         /*!
          * \brief Gets the player's sprite shadow.
          */
-        sf::Texture &getShadowPlayer() { return shadowPlayer; }
+        sf::Texture const &getShadowPlayer() { return *shadowPlayer; }
         /*!
          * \brief Gets the opponent's sprite shadow.
          */
-        sf::Texture &getShadowTrainer() { return shadowTrainer; }
+        sf::Texture const &getShadowTrainer() { return *shadowTrainer; }
         /*!
          * \brief Gets the gray healthbar.
          */
-        sf::Texture &getHealthbar1() { return healthbar1; }
+        sf::Texture const &getHealthbar1() { return *healthbar1; }
         /*!
          * \brief Gets the colored healthbar.
          */
-        sf::Texture &getHealthbar2() { return healthbar2; }
+        sf::Texture const &getHealthbar2() { return *healthbar2; }
     };
 
 } // namespace OpMon
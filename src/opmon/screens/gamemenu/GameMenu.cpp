@@ -21,7 +21,7 @@ namespace OpMon {
     GameMenu::GameMenu(GameMenuData &data)
         : data(data) {
         background.setTexture(data.getBackground());
-        menuBg.setTexture(data.getMenuTexture());
+        menuBg.setTexture(*data.getMenuTexture());
         for(size_t i = 0; i < 6; i++) {
             selections[i].setTexture(data.getSelectionTexture(i));
             selections[i].setPosition(data.getSelectionPos(i));
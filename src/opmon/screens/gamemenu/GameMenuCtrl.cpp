@@ -33,7 +33,9 @@ namespace OpMon {
         GameMenuCtrl::GameMenuCtrl(GameMenuData &data, Player &player)
           : data(data)
           , view(data)
-          , player(player) {
+          , player(player)
+          , arrowSound(data.getUiDataPtr()->getJukebox().getSound("arrow"))
+          , nopeSound(data.getUiDataPtr()->getJukebox().getSound("nope")) {
         }
 
         GameStatus GameMenuCtrl::checkEvent(sf::Event const &event) {
@@ -43,19 +45,19 @@ namespace OpMon {
                     return GameStatus::PREVIOUS_NLS;
                 }
                 if(event.key.code == sf::Keyboard::Up) {
-                    data.getUiDataPtr()->getJukebox().playSound("arrow");
+                    data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                     curPos -= 2;
                 }
                 if(event.key.code == sf::Keyboard::Down) {
-                    data.getUiDataPtr()->getJukebox().playSound("arrow");
+                    data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                     curPos += 2;
                 }
                 if(event.key.code == sf::Keyboard::Left) {
-                    data.getUiDataPtr()->getJukebox().playSound("arrow");
+                    data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                     curPos--;
                 }
                 if(event.key.code == sf::Keyboard::Right) {
-                    data.getUiDataPtr()->getJukebox().playSound("arrow");
+                    data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                     curPos++;
                 }
                 if(event.key.code == sf::Keyboard::Return) {
@@ -64,7 +66,7 @@ namespace OpMon {
                         loadNext = LOAD_OPTIONS;
                         return GameStatus::NEXT_NLS;
                     default:
-                        data.getUiDataPtr()->getJukebox().playSound("nope");
+                        data.getUiDataPtr()->getJukebox().playSound(nopeSound);
                         break;
                     }
                 }
@@ -77,7 +79,9 @@ namespace OpMon {
         }
 
         GameStatus GameMenuCtrl::update(sf::RenderTexture &frame) {
-            frame.draw(view);
+            if(renderEnabled) {
+                frame.draw(view);
+            }
             return GameStatus::CONTINUE;
         }
 
@@ -8,6 +8,7 @@
 #include "src/utils/CycleCounter.hpp"
 #include "GameMenu.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/view/ui/Jukebox.hpp"
 
 namespace sf {
 class Event;
@@ -39,6 +40,11 @@ class Player;
          * \brief The position of the cursor on the menu.
          */
         Utils::CycleCounter curPos = Utils::CycleCounter(6);
+        /*!
+         * \brief The sounds played by the menu.
+         */
+        Ui::SoundId arrowSound;
+        Ui::SoundId nopeSound;
 
     public:
         ~GameMenuCtrl();
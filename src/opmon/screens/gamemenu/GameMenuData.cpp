@@ -7,7 +7,9 @@
 #include "GameMenuData.hpp"
 
 
+#include "src/utils/ResourceCache.hpp"
 #include "src/utils/ResourceLoader.hpp"
+#include "src/utils/threadpool.hpp"
 
 namespace OpMon {
 class Player;
@@ -16,8 +18,12 @@ class UiData;
     GameMenuData::GameMenuData(UiData *data, Player *player)
         : uidata(data)
         , player(player) {
-        Utils::ResourceLoader::load(menuTexture, "backgrounds/menu.png");
-        Utils::ResourceLoader::loadTextureArray(selectionTexture, "backgrounds/menuS%d.png", 6, 1);
+        //All the textures are loaded in parallel
+        auto menuLoading = Utils::ResourceCache::loadTexture("backgrounds/menu.png");
+        Utils::TextureBatch textures;
+        textures.addArray(selectionTexture, "backgrounds/menuS%d.png", 6, 1);
+        textures.wait();
+        menuTexture = Utils::ThreadPool::wait(menuLoading);
 
         selectionPos[0] = sf::Vector2f(106, 77);
         selectionPos[1] = sf::Vector2f(252, selectionPos[0].y);
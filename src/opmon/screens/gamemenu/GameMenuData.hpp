@@ -17,7 +17,7 @@ class UiData;
      */
     class GameMenuData {
     private:
-        sf::Texture menuTexture;
+        std::shared_ptr<const sf::Texture> menuTexture;
         sf::Texture background;
 
         sf::Texture selectionTexture[6];
@@ -42,7 +42,7 @@ class UiData;
         /*!
          * \brief Gets the background texture of the in-game menu.
          */
-        sf::Texture &getMenuTexture() { return menuTexture; }
+        std::shared_ptr<const sf::Texture> getMenuTexture() { return menuTexture; }
         /*!
          * \brief Gets the last saved background by GameMenuData::setBackground for the open/close animations.
          */
@@ -28,7 +28,10 @@ namespace OpMon {
 
     MainMenuCtrl::MainMenuCtrl(UiData *data)
         : data(data)
-        , view(this->data) {
+        , view(this->data)
+        , pushSound(data->getJukebox().getSound("push"))
+        , nopeSound(data->getJukebox().getSound("nope"))
+        , arrowSound(data->getJukebox().getSound("arrow")) {
     }
 
     GameStatus MainMenuCtrl::checkEvent(sf::Event const &event) {
@@ -39,28 +42,28 @@ namespace OpMon {
                 switch(curPosI.getValue()) {
                 case 0:
                     loadNext = LOAD_STARTSCENE;
-                    data.getUiDataPtr()->getJukebox().playSound("push");
+                    data.getUiDataPtr()->getJukebox().playSound(pushSound);
                     return GameStatus::NEXT;
                 case 1:
-                    data.getUiDataPtr()->getJukebox().playSound("nope");
+                    data.getUiDataPtr()->getJukebox().playSound(nopeSound);
                     return GameStatus::CONTINUE;
                 case 2:
                     loadNext = LOAD_OPTIONS;
-                    data.getUiDataPtr()->getJukebox().playSound("push");
+                    data.getUiDataPtr()->getJukebox().playSound(pushSound);
                     return GameStatus::NEXT_NLS;
                 case 3:
-                    data.getUiDataPtr()->getJukebox().playSound("push");
+                    data.getUiDataPtr()->getJukebox().playSound(pushSound);
                     return GameStatus::STOP;
                 }
                 break;
                 //Moves the cursor
             case sf::Keyboard::Up:
                 curPosI--;
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                 break;
             case sf::Keyboard::Down:
                 curPosI++;
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
                 break;
             default:
                 break;
@@ -71,7 +74,9 @@ namespace OpMon {
 
     GameStatus MainMenuCtrl::update(sf::RenderTexture &frame) {
         view.update(curPosI.getValue());
-        frame.draw(view);
+        if(renderEnabled) {
+            frame.draw(view);
+        }
         return GameStatus::CONTINUE;
     }
 
@@ -9,6 +9,7 @@
 #include "MainMenu.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
 #include "src/utils/CycleCounter.hpp"
+#include "src/opmon/view/ui/Jukebox.hpp"
 
 namespace sf {
 class Event;
@@ -36,6 +37,12 @@ class UiData;
          * \brief The position of the cursor on the menu.
          */
         Utils::CycleCounter curPosI = Utils::CycleCounter(4);
+        /*!
+         * \brief The sounds played by the menu.
+         */
+        Ui::SoundId pushSound;
+        Ui::SoundId nopeSound;
+        Ui::SoundId arrowSound;
 
     public:
         MainMenuCtrl(UiData *data);
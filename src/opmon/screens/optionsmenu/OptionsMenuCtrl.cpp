@@ -32,7 +32,9 @@ namespace OpMon {
 
     OptionsMenuCtrl::OptionsMenuCtrl(UiData *data)
         : data(data)
-        , view(this->data) {
+        , view(this->data)
+        , pushSound(data->getJukebox().getSound("push"))
+        , arrowSound(data->getJukebox().getSound("arrow")) {
     }
 
     GameStatus OptionsMenuCtrl::checkEvent(sf::Event const &event) {
@@ -70,10 +72,10 @@ namespace OpMon {
                 if(menu.getCurrentOption() == OptionType::ALL) {
                     switch(menu.cursorPosition()) {
                     case BACK:
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         return GameStatus::PREVIOUS;
                     case FULLSCREEN:
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         if(data.getUiDataPtr()->getOptions().getParam("fullscreen").getValue() == "true") {
                             data.getUiDataPtr()->getOptions().addOrModifParam("fullscreen", "false");
                         } else {
@@ -82,21 +84,21 @@ namespace OpMon {
                         view.initOptionsMenuItemsValue();
                         return GameStatus::WIN_REBOOT;
                     case LANGUAGE:
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         menu.setCurrentOption(OptionType::LANG);
                         return GameStatus::CONTINUE;
                         break;
                     case CONTROLS:
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         menu.setCurrentOption(OptionType::CONTROLS);
                         return GameStatus::CONTINUE;
                         break;
                     case VOLUME:
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         toggleVolume();
                         break;
                     case CREDITS:
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         menu.setCurrentOption(OptionType::CREDITS);
                         return GameStatus::CONTINUE;
                         break;
@@ -104,7 +106,7 @@ namespace OpMon {
                 } else if(menu.getCurrentOption() == OptionType::LANG) { //Chooses language to print
 
                     auto &tr = Utils::I18n::Translator::getInstance();
-                    data.getUiDataPtr()->getJukebox().playSound("push");
+                    data.getUiDataPtr()->getJukebox().playSound(pushSound);
                     switch(menu.cursorPosition()) {
                     case 0:
                         menu.setCurrentOption(OptionType::ALL);
@@ -135,17 +137,17 @@ namespace OpMon {
                     view.initOptionsMenuItemsName();
                 } else if(menu.getCurrentOption() == OptionType::CREDITS) {
                     //Only one choice is avilable on the credits : back.
-                    data.getUiDataPtr()->getJukebox().playSound("push");
+                    data.getUiDataPtr()->getJukebox().playSound(pushSound);
                     menu.setCurrentOption(OptionType::ALL);
                     return GameStatus::CONTINUE;
                 } else if(menu.getCurrentOption() == OptionType::CONTROLS) {
                     switch(menu.cursorPosition()) {
                     case 0: //Back
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         menu.setCurrentOption(OptionType::ALL);
                         return GameStatus::CONTINUE;
                     case 1: //Set controls
-                        data.getUiDataPtr()->getJukebox().playSound("push");
+                        data.getUiDataPtr()->getJukebox().playSound(pushSound);
                         keyChangeActive = true;
                         view.setCurrentKeyChange(currentKeyChange + 1);
                         break;
@@ -159,12 +161,12 @@ namespace OpMon {
             }
             if(event.key.code == sf::Keyboard::Up) {
                 menu.moveArrow(true);
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
             } else if(event.key.code == sf::Keyboard::Down) {
                 menu.moveArrow(false);
-                data.getUiDataPtr()->getJukebox().playSound("arrow");
+                data.getUiDataPtr()->getJukebox().playSound(arrowSound);
             } else if(event.key.code == sf::Keyboard::BackSpace) {
-                data.getUiDataPtr()->getJukebox().playSound("push");
+                data.getUiDataPtr()->getJukebox().playSound(pushSound);
                 if(menu.getCurrentOption() == OptionType::ALL) {
                     //Returns to the previous game screen if backspace is pressed while in the options' main menu.
                     return GameStatus::PREVIOUS;
@@ -192,7 +194,9 @@ namespace OpMon {
 
     GameStatus OptionsMenuCtrl::update(sf::RenderTexture &frame) {
         GameStatus status = view.update();
-        frame.draw(view);
+        if(renderEnabled) {
+            frame.draw(view);
+        }
         return status;
     }
 
@@ -14,6 +14,7 @@
 #include "src/opmon/screens/mainmenu/MainMenu.hpp"
 #include "OptionsMenu.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
+#include "src/opmon/view/ui/Jukebox.hpp"
 
 namespace sf {
 class Event;
@@ -36,6 +37,11 @@ class UiData;
          * \brief The currently selected key to change in the controls menu.
          */
         std::size_t currentKeyChange{0};
+        /*!
+         * \brief The sounds played by the menu.
+         */
+        Ui::SoundId pushSound;
+        Ui::SoundId arrowSound;
         /*!
          * \brief If the controls edition mode is on or off.
          */
@@ -12,10 +12,12 @@ class UiData;
 
     OptionsMenuData::OptionsMenuData(UiData *data)
         : uidata(data) {
-        Utils::ResourceLoader::load(selectBar, "sprites/misc/selectBar.png");
-        Utils::ResourceLoader::load(creditsBg, "backgrounds/credits.png");
-        Utils::ResourceLoader::load(controlsBg, "backgrounds/controls.png");
-        Utils::ResourceLoader::load(volumeCur, "sprites/misc/cursor.png");
-        Utils::ResourceLoader::load(keyChange, "sprites/misc/keyChange.png");
+        Utils::TextureBatch textures;
+        textures.add(selectBar, "sprites/misc/selectBar.png");
+        textures.add(creditsBg, "backgrounds/credits.png");
+        textures.add(controlsBg, "backgrounds/controls.png");
+        textures.add(volumeCur, "sprites/misc/cursor.png");
+        textures.add(keyChange, "sprites/misc/keyChange.png");
+        textures.wait();
     }
 } // namespace OpMon
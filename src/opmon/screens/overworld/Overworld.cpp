@@ -6,6 +6,8 @@
 */
 
 #define FPS_TICKS 33
+//Distance, in tiles, from which the destination of a teleportation event is loaded in advance
+#define PREFETCH_DISTANCE 6
 
 #include "Overworld.hpp"
 
@@ -15,12 +17,15 @@
 #include <algorithm>
 #include <map>
 #include <iostream>
+#include <set>
 #include <sstream>
 #include <vector>
 
 #include "src/opmon/model/Enums.hpp"
 #include "src/utils/defines.hpp"
 #include "src/utils/log.hpp"
+#include "src/utils/mainthread.hpp"
+#include "src/utils/profiler.hpp"
 #include "src/utils/time.hpp"
 #include "src/utils/i18n/Translator.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
@@ -35,6 +40,12 @@
 
 namespace OpMon {
 
+    namespace {
+        sf::Vector2f interpolate(const sf::Vector2f (&positions)[2], float interpolation) {
+            return positions[0] + (positions[1] - positions[0]) * interpolation;
+        }
+    } // namespace
+
     void Overworld::setMusic(std::string const &mus) {
         data.getUiDataPtr()->getJukebox().play(mus);
     }
@@ -119,10 +130,14 @@ namespace OpMon {
         //"i" is the element's id
         for(std::string const &i : current->getAnimatedElements()) {
             data.incrementElementCounter(i);
-            if(data.getElementCounter(i) >= data.getElementTextures(i).size()) {
+            const Ui::Frames *frames = current->getTextures(i);
+            if(frames == nullptr || data.getElementCounter(i) >= frames->size()) {
                 data.resetElementCounter(i);
             }
-            elementsSprites[i].setTexture(data.getCurrentElementTexture(i));
+            if(frames != nullptr && frames->texture != nullptr) {
+                elementsSprites[i].setTexture(*frames->texture);
+                elementsSprites[i].setTextureRect(frames->rects[data.getElementCounter(i)]);
+            }
             elementsSprites[i].setPosition(data.getElementPos(i));
         }
     }
@@ -135,16 +150,193 @@ namespace OpMon {
     }
 
     void Overworld::tp(std::string toTp, sf::Vector2i pos) {
+        PrefetchedMap prefetched;
+        auto prefetch = prefetches.find(toTp);
+        if(prefetch != prefetches.end()) {
+            prefetched = waitPrefetch(toTp, prefetch->second);
+            prefetches.erase(prefetch);
+            if(prefetched.map) {
+                data.addLoadedMap(toTp, prefetched.map.release());
+            }
+        }
+
+        //If the map hasn't been prefetched, it is loaded here
         data.getPlayer().tp(toTp, pos);
         current = data.getCurrentMap();
+        drawOrder.clear();
+        sortEvents();
         character.setPosition(pos.x SQUARES - 16, pos.y SQUARES);
         resetCamera();
         setMusic(current->getBg());
 
         //Recreates the layers
-        layer1 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer1());
-        layer2 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer2());
-        layer3 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer3());
+        if(prefetched.layers[0] && prefetched.layers[1] && prefetched.layers[2]) {
+            layer1 = std::move(prefetched.layers[0]);
+            layer2 = std::move(prefetched.layers[1]);
+            layer3 = std::move(prefetched.layers[2]);
+        } else {
+            layer1 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer1(), current->getAtlas());
+            layer2 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer2(), current->getAtlas());
+            layer3 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer3(), current->getAtlas());
+        }
+        snapInterpolation = true;
+    }
+
+    Overworld::PrefetchedMap Overworld::waitPrefetch(std::string const &id, std::future<PrefetchedMap> &prefetch) {
+        //The loading thread may be waiting for the main thread to create its buffers
+        while(prefetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            Utils::MainThread::processTasks(std::chrono::milliseconds(1));
+        }
+        try {
+            return prefetch.get();
+        } catch(std::exception &e) {
+            Utils::Log::warn("Unable to load " + id + " in advance: " + e.what());
+            return PrefetchedMap();
+        }
+    }
+
+    void Overworld::prefetchMaps() {
+        sf::Vector2i playerPosition = data.getPlayer().getPosition().getPosition();
+        if(playerPosition == prefetchPosition) {
+            return;
+        }
+        prefetchPosition = playerPosition;
+
+        std::set<std::string> destinations;
+        sf::Vector2i pos;
+        for(pos.y = playerPosition.y - PREFETCH_DISTANCE; pos.y <= playerPosition.y + PREFETCH_DISTANCE; ++pos.y) {
+            for(pos.x = playerPosition.x - PREFETCH_DISTANCE; pos.x <= playerPosition.x + PREFETCH_DISTANCE; ++pos.x) {
+                for(Elements::AbstractEvent *event : current->getEvent(pos)) {
+                    std::string destination = event->getTeleportDestination();
+                    if(!destination.empty() && destination != data.getPlayer().getMapId()) {
+                        destinations.insert(destination);
+                    }
+                }
+            }
+        }
+
+        for(auto itor = prefetches.begin(); itor != prefetches.end();) {
+            if(!destinations.contains(itor->first) && itor->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                PrefetchedMap prefetched = waitPrefetch(itor->first, itor->second);
+                if(prefetched.map) {
+                    data.addLoadedMap(itor->first, prefetched.map.release());
+                }
+                itor = prefetches.erase(itor);
+            } else {
+                ++itor;
+            }
+        }
+
+        for(std::string const &destination : destinations) {
+            if(prefetches.contains(destination)) {
+                continue;
+            }
+            Elements::Map *unloadedMap = data.getUnloadedCopy(destination);
+            if(unloadedMap == nullptr) {
+                continue;
+            }
+            prefetches.emplace(destination, std::async(std::launch::async, [this, unloadedMap]() {
+                Utils::Profiler::Zone zone("Overworld::prefetchMaps");
+                std::unique_ptr<Elements::Map> unloaded(unloadedMap);
+                PrefetchedMap prefetched;
+                prefetched.map.reset(data.loadMap(*unloaded));
+                Elements::Map &map = *prefetched.map;
+                prefetched.layers[0] = std::make_unique<Ui::MapLayer>(map.getDimensions(), map.getLayer1(), map.getAtlas());
+                prefetched.layers[1] = std::make_unique<Ui::MapLayer>(map.getDimensions(), map.getLayer2(), map.getAtlas());
+                prefetched.layers[2] = std::make_unique<Ui::MapLayer>(map.getDimensions(), map.getLayer3(), map.getAtlas());
+                //The music of the destination is opened too, so it starts as soon as the player arrives
+                std::string music = map.getBg();
+                Utils::MainThread::run([this, &music]() { data.getUiDataPtr()->getJukebox().prefetch(music); });
+                return prefetched;
+            }));
+        }
+    }
+
+    Overworld::~Overworld() {
+        //The loading threads use the overworld, so they must end before it is destroyed
+        for(auto &prefetch : prefetches) {
+            waitPrefetch(prefetch.first, prefetch.second);
+        }
+    }
+
+    void Overworld::sortEvents() {
+        const std::vector<Elements::AbstractEvent *> &events = current->getEvents();
+        if(drawOrder.size() != events.size()) {
+            drawOrder = events;
+        }
+        for(std::size_t i = 1; i < drawOrder.size(); i++) {
+            Elements::AbstractEvent *event = drawOrder[i];
+            float y = event->getSprite()->getPosition().y;
+            std::size_t j = i;
+            for(; j > 0 && drawOrder[j - 1]->getSprite()->getPosition().y > y; j--) {
+                drawOrder[j] = drawOrder[j - 1];
+            }
+            drawOrder[j] = event;
+        }
+    }
+
+    const std::vector<Elements::AbstractEvent *> &Overworld::scheduleEvents() {
+        scheduleTick++;
+        scheduledEvents.clear();
+        std::swap(previousScheduledIndexes, scheduledIndexes);
+        scheduledIndexes.clear();
+        sf::Vector2f activeSize = camera.getSize() + sf::Vector2f(2 * EVENTS_ACTIVE_DISTANCE SQUARES, 2 * EVENTS_ACTIVE_DISTANCE SQUARES);
+        sf::Vector2f idleSize = camera.getSize() + sf::Vector2f(2 * EVENTS_IDLE_DISTANCE SQUARES, 2 * EVENTS_IDLE_DISTANCE SQUARES);
+        sf::FloatRect active(camera.getCenter() - activeSize / 2.f, activeSize);
+        sf::FloatRect idle(camera.getCenter() - idleSize / 2.f, idleSize);
+
+        const std::vector<Elements::AbstractEvent *> &events = current->getEvents();
+        for(std::size_t i = 0; i < events.size(); i++) {
+            sf::Vector2f position = events[i]->getPosition();
+            //The idle events are spread over the ticks, so they aren't all updated during the same tick
+            if(events[i]->isBusy() || active.contains(position) || (idle.contains(position) && (scheduleTick + i) % EVENTS_IDLE_RATE == 0)) {
+                scheduledEvents.push_back(events[i]);
+                scheduledIndexes.push_back(i);
+            }
+        }
+        return scheduledEvents;
+    }
+
+    void Overworld::saveTickPositions() {
+        characterTickPositions[0] = snapInterpolation ? character.getPosition() : characterTickPositions[1];
+        characterTickPositions[1] = character.getPosition();
+        cameraTickCenters[0] = snapInterpolation ? camera.getCenter() : cameraTickCenters[1];
+        cameraTickCenters[1] = camera.getCenter();
+        if(snapInterpolation) {
+            for(Elements::AbstractEvent *event : current->getEvents()) {
+                event->saveTickPosition(true);
+            }
+            //The indexes scheduled before a teleportation are those of the previous map
+            scheduledIndexes.clear();
+        } else {
+            for(Elements::AbstractEvent *event : scheduledEvents) {
+                event->saveTickPosition(false);
+            }
+            //The suspended events don't move : the events which have just been suspended stop being interpolated.
+            //Both lists are sorted, since the events are scheduled in the order of the map.
+            const std::vector<Elements::AbstractEvent *> &events = current->getEvents();
+            std::size_t j = 0;
+            for(std::size_t index : previousScheduledIndexes) {
+                while(j < scheduledIndexes.size() && scheduledIndexes[j] < index) {
+                    j++;
+                }
+                if((j == scheduledIndexes.size() || scheduledIndexes[j] != index) && index < events.size()) {
+                    events[index]->saveTickPosition(true);
+                }
+            }
+        }
+        snapInterpolation = false;
+    }
+
+    void Overworld::setInterpolation(float interpolation) {
+        this->interpolation = interpolation;
+
+        fpsCounter++;
+        if(Utils::Time::getElapsedMilliseconds() - oldTicksFps >= 1000) {
+            fpsPrint.setString(std::to_string(fpsCounter));
+            fpsCounter = 0;
+            oldTicksFps = Utils::Time::getElapsedMilliseconds();
+        }
     }
 
     void Overworld::pause() {
@@ -158,6 +350,7 @@ namespace OpMon {
     Overworld::Overworld(const std::string &mapId, OverworldData &data)
         : data(data) {
         current = data.getMap(mapId);
+        sortEvents();
         character.setTexture(data.getTexturePP());
         character.setTextureRect(data.getTexturePPRect((unsigned int)Side::TO_DOWN));
         data.getPlayer().tp(mapId, sf::Vector2i(2, 4)); //TODO : Add a parameter to configure the default player's position
@@ -166,9 +359,9 @@ namespace OpMon {
         resetCamera();
 
         setMusic(current->getBg());
-        layer1 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer1());
-        layer2 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer2());
-        layer3 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer3());
+        layer1 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer1(), current->getAtlas());
+        layer2 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer2(), current->getAtlas());
+        layer3 = std::make_unique<Ui::MapLayer>(current->getDimensions(), current->getLayer3(), current->getAtlas());
         character.setScale(2, 2);
         character.setOrigin(16, 16);
 
@@ -178,8 +371,11 @@ namespace OpMon {
     }
 
     void Overworld::draw(sf::RenderTarget &frame, sf::RenderStates states) const {
+        Utils::Profiler::Zone zone("Overworld::draw");
         bool is_in_dialog = this->dialog && !this->dialog->isDialogOver();
-        frame.setView(camera);
+        sf::View interpolatedCamera = camera;
+        interpolatedCamera.setCenter(interpolate(cameraTickCenters, interpolation));
+        frame.setView(interpolatedCamera);
         frame.clear(sf::Color::Black);
 
         //Drawing the two first layers
@@ -189,23 +385,22 @@ namespace OpMon {
         if((debugMode ? printlayer[1] : true)) {
             frame.draw(*layer2);
         }
-        //Drawing events under the player
-        for(const Elements::AbstractEvent *event : current->getEvents()) {
+        //Drawing the events and the player, from the highest to the lowest
+        float playerY = data.getPlayer().getPosition().getPositionPixel().y;
+        bool playerAdded = false;
+        spriteBatch.clear();
+        for(const Elements::AbstractEvent *event : drawOrder) {
             const sf::Sprite *sprite = event->getSprite();
-            if(sprite->getPosition().y <= data.getPlayer().getPosition().getPositionPixel().y) {
-                frame.draw(*sprite);
+            if(!playerAdded && sprite->getPosition().y > playerY) {
+                spriteBatch.add(character, interpolate(characterTickPositions, interpolation));
+                playerAdded = true;
             }
+            spriteBatch.add(*sprite, event->getInterpolatedPosition(interpolation));
         }
-
-        frame.draw(character);
-
-        //Drawing the events above the player
-        for(const Elements::AbstractEvent *event : current->getEvents()) {
-            const sf::Sprite *sprite = event->getSprite();
-            if(sprite->getPosition().y > data.getPlayer().getPosition().getPositionPixel().y) {
-                frame.draw(*sprite);
-            }
+        if(!playerAdded) {
+            spriteBatch.add(character, interpolate(characterTickPositions, interpolation));
         }
+        frame.draw(spriteBatch, states);
 
         if(debugMode && printCollisions) {
             printCollisionLayer(frame);
@@ -234,6 +429,7 @@ namespace OpMon {
     }
 
     GameStatus Overworld::update() {
+        Utils::Profiler::Zone zone("Overworld::update");
         bool is_in_dialog = this->dialog && !this->dialog->isDialogOver();
 
         if(initPlayerAnimation) {
@@ -241,13 +437,6 @@ namespace OpMon {
             initPlayerAnimation = false;
         }
 
-        fpsCounter++;
-        if(Utils::Time::getElapsedMilliseconds() - oldTicksFps >= 1000) {
-            fpsPrint.setString(std::to_string(fpsCounter));
-            fpsCounter = 0;
-            oldTicksFps = Utils::Time::getElapsedMilliseconds();
-        }
-
         if(debugMode) {
             std::cout << "Elapsed Time: " << Utils::Time::getElapsedSeconds() << "s" << std::endl;
             std::cout << "Loop : " << (is_in_dialog ? "Dialog" : "Normal") << std::endl;
@@ -282,8 +471,8 @@ namespace OpMon {
 
         updateCamera();
 
-        //Drawing events under the player
-        for(Elements::AbstractEvent *event : current->getEvents()) {
+        //After a teleportation, the events of the new map haven't been scheduled yet
+        for(Elements::AbstractEvent *event : snapInterpolation ? current->getEvents() : scheduledEvents) {
             event->updateTexture();
         }
 
@@ -332,13 +521,13 @@ namespace OpMon {
             character.setTextureRect(data.getTexturePPRect((unsigned int)data.getPlayer().getPosition().getDir()));
         }
 
-        //Drawing the events above the player
-        for(Elements::AbstractEvent *event : current->getEvents()) {
-            event->updateTexture();
-        }
-
         updateElements();
 
+        prefetchMaps();
+
+        sortEvents();
+        saveTickPositions();
+
         return GameStatus::CONTINUE;
     }
 
@@ -355,9 +544,10 @@ namespace OpMon {
             {7, sf::Color(255, 50, 0, 128)},
             {8, sf::Color(255, 50, 0, 128)}};
 
+        std::span<const std::uint8_t> collisions = current->getCollisions();
         for(pos.x = 0; pos.x < current->getW(); ++pos.x) {
             for(pos.y = 0; pos.y < current->getH(); ++pos.y) {
-                int collision = current->getCollision(pos);
+                int collision = COLLISION_CODE(collisions[pos.x + pos.y * current->getW()]);
                 if(collision != 0) {
                     tile.setFillColor(collision2Color[collision]);
                     tile.setPosition(pos.x SQUARES, pos.y SQUARES);
@@ -8,13 +8,30 @@
 #define OVERWORLD_HPP
 
 #include <SFML/Graphics/View.hpp>
+#include <future>
+#include <map>
+#include <memory>
 
 #include "OverworldData.hpp"
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Elements.hpp"
+#include "src/opmon/view/ui/SpriteBatch.hpp"
 #include "src/opmon/core/GameStatus.hpp"
 #include "src/opmon/view/elements/events/BattleEvent.hpp"
 
+/*!
+ * \brief The distance, in squares, around the camera in which the events are updated every tick.
+ */
+#define EVENTS_ACTIVE_DISTANCE 4
+/*!
+ * \brief The distance, in squares, around the camera in which the events are updated every EVENTS_IDLE_RATE ticks. The events further are suspended.
+ */
+#define EVENTS_IDLE_DISTANCE 16
+/*!
+ * \brief The number of ticks between two updates of an idle event (see EVENTS_IDLE_DISTANCE).
+ */
+#define EVENTS_IDLE_RATE 4
+
 namespace sf {
 class RenderTarget;
 }  // namespace sf
@@ -50,10 +67,17 @@ class TrainerEvent;
         }
 
         /*!
-         * \brief Updates the overworld.
+         * \brief Updates the overworld by one tick.
          */
         GameStatus update();
 
+        /*!
+         * \brief Sets the position between the last two ticks at which the overworld will be drawn.
+         * \details Called once per displayed frame, before drawing.
+         * \param interpolation The time elapsed since the last tick, as a fraction of a tick.
+         */
+        void setInterpolation(float interpolation);
+
         void draw(sf::RenderTarget& frame, sf::RenderStates states) const;
 
         /*!
@@ -100,7 +124,7 @@ class TrainerEvent;
          */
         bool justTp = false;
 
-        virtual ~Overworld() = default;
+        virtual ~Overworld();
 
         virtual void play();
         virtual void pause();
@@ -164,6 +188,15 @@ class TrainerEvent;
 
         OverworldData &getData() { return data; }
 
+        /*!
+         * \brief Chooses the events of the current map to update during this tick.
+         * \details The events near the camera are updated every tick, the events a bit further every EVENTS_IDLE_RATE ticks,
+         * and the other events are suspended. The busy events (see Elements::AbstractEvent::isBusy) are always updated, so the scripted
+         * sequences started near the player end normally.
+         * \returns The events to update. Overworld::update only updates the textures of these events.
+         */
+        const std::vector<Elements::AbstractEvent *> &scheduleEvents();
+
         /*!
          * \brief If `true`, the game is in debug mode.
          */
@@ -197,6 +230,41 @@ class TrainerEvent;
          */
         void resetCamera();
 
+        /*!
+         * \brief Saves the positions of the moving elements at the end of a tick, to interpolate them in draw().
+         * \details If Overworld::snapInterpolation is `true`, the previous positions are forgotten.
+         * The events leaving the schedule are snapped, since their positions aren't saved while they are suspended.
+         */
+        void saveTickPositions();
+
+        /*!
+         * \brief A map loaded in advance by another thread, with its layers.
+         */
+        struct PrefetchedMap {
+            std::unique_ptr<Elements::Map> map;
+            std::unique_ptr<Ui::MapLayer> layers[3];
+        };
+
+        /*!
+         * \brief Starts loading the destinations of the teleportation events near the player in other threads.
+         * \details Called when the player changes of tile. The prefetched maps are used by Overworld::tp.
+         * The finished prefetches whose events are no longer near the player are given to the OverworldData, and their layers are dropped.
+         */
+        void prefetchMaps();
+
+        /*!
+         * \brief Waits for a prefetch to end, while running the tasks its thread gives to the main thread.
+         * \returns The prefetched map, or an empty PrefetchedMap if the loading failed.
+         */
+        PrefetchedMap waitPrefetch(std::string const &id, std::future<PrefetchedMap> &prefetch);
+
+        /*!
+         * \brief Sorts Overworld::drawOrder by the vertical position of the events.
+         * \details The events move little between two ticks, so the order of the previous tick is only fixed with an insertion sort.
+         * The order is rebuilt after a teleportation, or if the number of events has changed.
+         */
+        void sortEvents();
+
         Elements::BattleEvent *trainerToBattle = nullptr;
 
         sf::Text debugText;
@@ -211,6 +279,27 @@ class TrainerEvent;
         std::unique_ptr<Ui::MapLayer> layer2;
         std::unique_ptr<Ui::MapLayer> layer3;
         std::unique_ptr<Ui::Dialog> dialog;
+        /*!
+         * \brief The events of the current map, from the highest to the lowest on the screen. The events are drawn in this order.
+         */
+        std::vector<Elements::AbstractEvent *> drawOrder;
+        /*!
+         * \brief Draws the events and the player. Kept between two frames to reuse its memory.
+         */
+        mutable Ui::SpriteBatch spriteBatch;
+        /*!
+         * \brief The events updated during this tick (see Overworld::scheduleEvents).
+         */
+        std::vector<Elements::AbstractEvent *> scheduledEvents;
+        /*!
+         * \brief The indexes in the events of the current map of the events updated during this tick, and during the previous tick.
+         */
+        std::vector<std::size_t> scheduledIndexes;
+        std::vector<std::size_t> previousScheduledIndexes;
+        /*!
+         * \brief The number of calls to Overworld::scheduleEvents, used to spread the updates of the idle events over several ticks.
+         */
+        unsigned int scheduleTick = 0;
         /*!
          * \brief Indicates the frame of the walking animation that must be used.
          * \details Since the animation has two frames, this variable alternates between `true` and `false` every half of the animation.
@@ -228,8 +317,31 @@ class TrainerEvent;
 
         bool cameraLock = false;
 
+        /*!
+         * \brief The positions of the character and the camera at the end of the last two ticks.
+         */
+        sf::Vector2f characterTickPositions[2];
+        sf::Vector2f cameraTickCenters[2];
+        /*!
+         * \brief The time elapsed since the last tick when drawing, as a fraction of a tick.
+         */
+        float interpolation = 1;
+        /*!
+         * \brief If `true`, the next saved positions won't be interpolated from the previous ones. Set after a teleportation.
+         */
+        bool snapInterpolation = true;
+
         std::map<std::string, sf::Sprite> elementsSprites;
 
+        /*!
+         * \brief The maps being loaded in advance, by id.
+         */
+        std::map<std::string, std::future<PrefetchedMap>> prefetches;
+        /*!
+         * \brief The position of the player when Overworld::prefetchMaps was last called.
+         */
+        sf::Vector2i prefetchPosition{-1, -1};
+
         OverworldData &data;
     };
 
@@ -26,6 +26,8 @@
 #include "src/opmon/view/ui/Dialog.hpp"
 #include "src/opmon/view/ui/Jukebox.hpp"
 #include "src/opmon/core/GameStatus.hpp"
+#include "src/utils/input.hpp"
+#include "src/utils/ResourceCache.hpp"
 
 //Defines created to make the code easier to read
 #define LOAD_BATTLE 1
@@ -98,25 +100,30 @@ namespace OpMon {
 				if(events.key.code == sf::Keyboard::B) {
 					overworld.tp("Road 14", sf::Vector2i(10, 32));
 				}
+				//Writes the shared resources and their memory in the log
+				if(events.key.code == sf::Keyboard::L) {
+					Utils::ResourceCache::logMemory();
+				}
 			}
 			if(events.key.code == sf::Keyboard::M) {
 				loadNext = LOAD_MENU_OPEN;
+				captureScreen();
 				return GameStatus::NEXT_NLS;
 			}
 		default:
 			break;
 		}
 		if(overworld.isCameraLocked()) {
-			if(sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad2)) {
+			if(Utils::Input::isKeyPressed(sf::Keyboard::Numpad2)) {
 				overworld.moveCamera(Side::TO_DOWN);
 			}
-			if(sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad4)) {
+			if(Utils::Input::isKeyPressed(sf::Keyboard::Numpad4)) {
 				overworld.moveCamera(Side::TO_LEFT);
 			}
-			if(sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad8)) {
+			if(Utils::Input::isKeyPressed(sf::Keyboard::Numpad8)) {
 				overworld.moveCamera(Side::TO_UP);
 			}
-			if(sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad6)) {
+			if(Utils::Input::isKeyPressed(sf::Keyboard::Numpad6)) {
 				overworld.moveCamera(Side::TO_RIGHT);
 			}
 		}
@@ -146,6 +153,7 @@ namespace OpMon {
 				view.endBattle();
 			} else {
 				loadNext = LOAD_BATTLE;
+				captureScreen();
 				return GameStatus::NEXT;
 			}
 		}
@@ -153,20 +161,35 @@ namespace OpMon {
 		return GameStatus::CONTINUE;
 	}
 
-	GameStatus OverworldCtrl::update(sf::RenderTexture &frame) {
+	GameStatus OverworldCtrl::update(sf::RenderTexture &/*frame*/) {
+		//Done before updating the events, since an event can hold a pointer to the previous map during the tick of a teleportation.
+		data.trimMaps();
+
+		const std::vector<Elements::AbstractEvent *> &events = view.scheduleEvents();
 		bool is_dialog_open = view.getDialog() && !view.getDialog()->isDialogOver();
 		if(!is_dialog_open) {
-			updateEvents(data.getMap(player.getMapId())->getEvents(), player, view);
+			updateEvents(events, player, view);
 		}
 
-		GameStatus toReturn = view.update();
+		return view.update();
+	}
+
+	void OverworldCtrl::draw(sf::RenderTexture &frame, float interpolation) {
+		view.setInterpolation(interpolation);
 		frame.draw(view);
-		screenTexture = frame.getTexture();
-		return toReturn;
+		lastFrame = &frame;
+	}
+
+	void OverworldCtrl::captureScreen() {
+		//Nothing is drawn when the rendering is disabled
+		if(lastFrame == nullptr) {
+			return;
+		}
+		screenTexture = std::make_shared<const sf::Texture>(lastFrame->getTexture());
+		data.getGameMenuData().setBackground(*screenTexture);
 	}
 
 	void OverworldCtrl::loadNextScreen() {
-		data.getGameMenuData().setBackground(screenTexture);
 		switch(loadNext) {
 		case LOAD_BATTLE:
 			_next_gs = std::make_unique<BattleCtrl>(data.getPlayer().getOpTeam(), view.getBattleDeclared(), data.getUiDataPtr(), data.getPlayerPtr());
@@ -198,16 +221,16 @@ namespace OpMon {
 	void OverworldCtrl::checkMove(Player &player, Overworld &overworld) {
 		if(!overworld.justTp && !player.getPosition().isAnim() && !player.getPosition().isLocked()) {
 			//TODO Factorise code
-			if(sf::Keyboard::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyUp())) {
+			if(Utils::Input::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyUp())) {
 				overworld.startPlayerAnimation();
 				move(Side::TO_UP, player, overworld);
-			} else if(sf::Keyboard::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyDown())) {
+			} else if(Utils::Input::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyDown())) {
 				overworld.startPlayerAnimation();
 				move(Side::TO_DOWN, player, overworld);
-			} else if(sf::Keyboard::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyLeft())) {
+			} else if(Utils::Input::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyLeft())) {
 				overworld.startPlayerAnimation();
 				move(Side::TO_LEFT, player, overworld);
-			} else if(sf::Keyboard::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyRight())) {
+			} else if(Utils::Input::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyRight())) {
 				overworld.startPlayerAnimation();
 				move(Side::TO_RIGHT, player, overworld);
 			}
@@ -218,15 +241,14 @@ namespace OpMon {
 		player.getPosition().move(direction, overworld.getData().getCurrentMap(), debugCol);
 
 		Elements::Map *map = overworld.getData().getCurrentMap();
-		std::list<Elements::AbstractEvent*> eventList = map->getEvent(player.getPosition().getPosition());
-		actionEvents(eventList, player, Elements::EventTrigger::GO_IN, overworld);
+		actionEvents(map->getEvent(player.getPosition().getPosition()), player, Elements::EventTrigger::GO_IN, overworld);
 	}
 
 	void OverworldCtrl::checkAction(sf::Event const &event, Player &player, Overworld &overworld) {
 		//If the player isn't moving, then this checks if the player want to activate an event.
 		if(!player.getPosition().isAnim()) {
 			//Get the event coordinates and activate it if the player interacted with it.
-			if(sf::Keyboard::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyInteract())) {
+			if(Utils::Input::isKeyPressed(overworld.getData().getUiDataPtr()->getKeyInteract())) {
 				int lx = player.getPosition().getPosition().x;
 				int ly = player.getPosition().getPosition().y;
 				switch(player.getPosition().getDir()) {
@@ -246,43 +268,20 @@ namespace OpMon {
 					break;
 				}
 
-				std::list<Elements::AbstractEvent *> eventList = overworld.getData().getCurrentMap()->getEvent(sf::Vector2i(lx, ly));
-
-				//Checks if the event has been already triggered in the last frame.
-				//List of all elements present in eventList and already triggered in the last frame.
-				std::list<std::list<Elements::AbstractEvent *>::iterator> commonList;
-				for(std::list<Elements::AbstractEvent *>::iterator currentEvent = eventList.begin(); currentEvent != eventList.end(); ++currentEvent) {
-					bool alreadyUsed = false;
-					for(std::list<Elements::AbstractEvent*>::iterator usedEvent = usedList.begin(); usedEvent != usedList.end(); ++usedEvent) {
-						if(*usedEvent == *currentEvent) {
-							alreadyUsed = true;
-							commonList.push_back(currentEvent);
-						}
-					}
-				}
-				//Resets the used list with the current events
-				usedList = eventList;
-				//Deletes from eventList all events already triggered in the last frame.
-				for(std::list<Elements::AbstractEvent *>::iterator itor : commonList)
-					eventList.erase(itor);
-
-				actionEvents(eventList, player, Elements::EventTrigger::PRESS, overworld);
+				actionEvents(overworld.getData().getCurrentMap()->getEvent(sf::Vector2i(lx, ly)), player, Elements::EventTrigger::PRESS, overworld);
 			}
 		}
 
-		usedList.clear();
-
 		//Searches for events at the same position as the player and activates them if they are triggered when the playeris in them.
 		if(!player.getPosition().isMoving()) {
-			std::list<Elements::AbstractEvent *> eventList = overworld.getData().getCurrentMap()->getEvent(player.getPosition().getPosition());
-			actionEvents(eventList, player, Elements::EventTrigger::BE_IN, overworld);
+			actionEvents(overworld.getData().getCurrentMap()->getEvent(player.getPosition().getPosition()), player, Elements::EventTrigger::BE_IN, overworld);
 		}
 	}
 
-	void OverworldCtrl::actionEvents(std::list<Elements::AbstractEvent *> &events, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld) {
+	void OverworldCtrl::actionEvents(std::span<Elements::AbstractEvent *const> events, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld) {
 		//Checks if the player points at the right direction to activate the events. If yes, calls the events' action methods.
 		Side ppDir = player.getPosition().getDir();
-		for(std::list<Elements::AbstractEvent*>::iterator itor = events.begin(); itor != events.end(); ++itor) {
+		for(auto itor = events.begin(); itor != events.end(); ++itor) {
 			if((*itor)->getEventTrigger() == toTrigger) {
 				bool go = false;
 				if((((*itor)->getSide() & SIDE_UP) == SIDE_UP) && ppDir == Side::TO_UP) {
@@ -301,7 +300,7 @@ namespace OpMon {
 		}
 	}
 
-	void OverworldCtrl::updateEvents(std::vector<Elements::AbstractEvent *> &events, Player &player, Overworld &overworld) {
+	void OverworldCtrl::updateEvents(std::vector<Elements::AbstractEvent *> const &events, Player &player, Overworld &overworld) {
 		for(Elements::AbstractEvent *event : events) {
 			event->update(player, overworld);
 		}
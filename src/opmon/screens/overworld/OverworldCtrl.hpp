@@ -9,7 +9,8 @@
 
 #include "Overworld.hpp"
 #include "src/opmon/screens/base/AGameScreen.hpp"
-#include <list>
+#include <memory>
+#include <span>
 
 namespace sf {
 class Event;
@@ -48,21 +49,24 @@ class UiData;
 
         /*!
          * \brief Contains a screenshot.
-         * \details A screenshot of the frame is taken in update(sf::RenderTexture&). It used as a background in GameMenu and its opening/closing animations.
+         * \details A screenshot of the last drawn frame is taken by captureScreen() when the menu is opened or a battle starts. It used as a background in GameMenu and its opening/closing animations.
          */
-        sf::Texture screenTexture;
+        std::shared_ptr<const sf::Texture> screenTexture = std::make_shared<const sf::Texture>();
+        /*!
+         * \brief The frame given to the last call of draw(sf::RenderTexture&, float), `nullptr` if nothing has been drawn.
+         */
+        const sf::RenderTexture *lastFrame = nullptr;
 
         /*!
-         * \brief If `true`, the collision debug mode is activated (noclip).
+         * \brief Copies the last drawn frame in screenTexture and in the background of the game menu.
+         * \details Must be called on the main thread, before loadNextScreen(), which can run on a loading thread.
          */
-        bool debugCol = false;
+        void captureScreen();
 
         /*!
-         * \brief List of last activated events by pressing a button.
-         *
-         * This list is used in checkAction to avoid AbstractEvent::action being called in two consecutive frames.
+         * \brief If `true`, the collision debug mode is activated (noclip).
          */
-        std::list<Elements::AbstractEvent*> usedList;
+        bool debugCol = false;
 
     public:
         OverworldCtrl(Player &player, UiData *uidata);
@@ -77,6 +81,7 @@ class UiData;
          */
         GameStatus checkEventsNoDialog(sf::Event const &events, Player &player);
         GameStatus update(sf::RenderTexture &frame) override;
+        void draw(sf::RenderTexture &frame, float interpolation) override;
 
         virtual void loadNextScreen();
         virtual void suspend();
@@ -96,11 +101,11 @@ class UiData;
 
         /*!
          * \brief Calls Event::update for each event.
-         * \param events The events.
+         * \param events The events, chosen by Overworld::scheduleEvents.
          * \param player A reference to the player object.
          * \param overworld A reference to the overworld view.
          */
-        void updateEvents(std::vector<Elements::AbstractEvent *> &events, Player &player, Overworld &overworld);
+        void updateEvents(std::vector<Elements::AbstractEvent *> const &events, Player &player, Overworld &overworld);
 
         /*!
          * \brief Calls Event::action for some events.
@@ -115,7 +120,7 @@ class UiData;
          * Event::action for the events with this EventTrigger.
          * \param overworld A reference to the overworld view.
          */
-        void actionEvents(std::list<Elements::AbstractEvent *> &events, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld);
+        void actionEvents(std::span<Elements::AbstractEvent *const> events, Player &player, Elements::EventTrigger toTrigger, Overworld &overworld);
 
         /*!
          * \brief Calls actionEvents for some events.
@@ -5,12 +5,17 @@
 */
 #include "OverworldData.hpp"
 
-#include <fstream>
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
 
 #include "src/nlohmann/json.hpp"
 #include "src/utils/OpString.hpp"
+#include "src/utils/jsonindex.hpp"
 #include "src/utils/log.hpp"
+#include "src/utils/mainthread.hpp"
 #include "src/opmon/core/system/path.hpp"
 #include "src/utils/ResourceLoader.hpp"
 #include "src/opmon/core/Player.hpp"
@@ -22,6 +27,9 @@
 #include "src/opmon/model/OpTeam.hpp"
 #include "src/opmon/view/elements/Map.hpp"
 
+//Default memory budget of the loaded maps, in kilobytes
+#define DEFAULT_MAPS_MEMORY 8192
+
 namespace OpMon {
 
     OverworldData::OverworldData(UiData *uidata, Player *player)
@@ -31,7 +39,7 @@ namespace OpMon {
 
         using namespace Utils;
 
-        Attack::initAttacks(Path::getResourcePath() + "data/attacks.json");
+        Attack::initAttacks("data/attacks.json");
 
         player->addOpToOpTeam(new OpMon("", uidata->getOp(4), 5, {Attack::newAtk("Tackle"), Attack::newAtk("Growl"), nullptr, nullptr}, Nature::QUIET));
 
@@ -50,45 +58,43 @@ namespace OpMon {
         walkingPP2Rect[(unsigned int)Side::TO_LEFT] = sf::IntRect(64, 32, 32, 32);
         walkingPP2Rect[(unsigned int)Side::TO_UP] = sf::IntRect(96, 32, 32, 32);
 
-        //Characters' textures initialization
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["kid"], "sprites/chara/kid/kid%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["fisherman"], "sprites/chara/fisherman/fisherman%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["kiwai"], "sprites/chara/prof/prof%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["playermom"], "sprites/chara/mom/mom%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["sk"], "sprites/chara/rival/sk%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["inferm"], "sprites/chara/inferm/inferm%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["|_| -|- |-| |= |_| N"], "sprites/chara/beta/alphabeta/otheon%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["beta"], "sprites/chara/beta/beta%d.png", 12);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["albd"], "sprites/chara/albd/albd%d.png", 12);
+        //Characters' textures declaration. They are loaded with the first map using them.
+        spritesAtlas.declare("kid", "sprites/chara/kid/kid%d.png", 12);
+        spritesAtlas.declare("fisherman", "sprites/chara/fisherman/fisherman%d.png", 12);
+        spritesAtlas.declare("kiwai", "sprites/chara/prof/prof%d.png", 12);
+        spritesAtlas.declare("playermom", "sprites/chara/mom/mom%d.png", 12);
+        spritesAtlas.declare("sk", "sprites/chara/rival/sk%d.png", 12);
+        spritesAtlas.declare("inferm", "sprites/chara/inferm/inferm%d.png", 12);
+        spritesAtlas.declare("|_| -|- |-| |= |_| N", "sprites/chara/beta/alphabeta/otheon%d.png", 12);
+        spritesAtlas.declare("beta", "sprites/chara/beta/beta%d.png", 12);
+        spritesAtlas.declare("albd", "sprites/chara/albd/albd%d.png", 12);
 
         //Initialization of doors
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["shop door"], "animations/shopdoor/shop_door%d.png", 4, 1);
-        Utils::ResourceLoader::loadTextureArray(eventsTextures["door"], "animations/basicdoor/basic_door%d.png", 4, 1);
-
-        eventsTextures.emplace("alpha", alphaTab);
+        spritesAtlas.declare("shop door", "animations/shopdoor/shop_door%d.png", 4, 1);
+        spritesAtlas.declare("door", "animations/basicdoor/basic_door%d.png", 4, 1);
 
         //Initialization of animated elements
         elementsCounter["windturbine"] = 0;
         elementsPos["windturbine"] = sf::Vector2f(8 * 32 + 25 * 32 - 7, 3 * 32 + 15);
 
-        Utils::ResourceLoader::loadTextureArray(elementsTextures["windturbine"], "animations/windturbine/blade_%d.png", 16, 1);
+        spritesAtlas.declare("windturbine", "animations/windturbine/blade_%d.png", 16, 1);
 
         elementsCounter["smoke"] = 0;
         elementsPos["smoke"] = sf::Vector2f(8 * 32 + 18 * 32, 11 * 32);
 
-        Utils::ResourceLoader::loadTextureArray(elementsTextures["smoke"], "animations/chimneysmoke/chimneysmoke_%d.png", 32, 1);
+        spritesAtlas.declare("smoke", "animations/chimneysmoke/chimneysmoke_%d.png", 32, 1);
 
         //Items initialisation
 
         nlohmann::json itemsJson;
 
-        std::ifstream itemsJsonFile(Path::getResourcePath() + "data/items.json");
+        std::unique_ptr<std::istream> itemsJsonFile = Utils::ResourceLoader::openFile("data/items.json");
 
         if(!itemsJsonFile) {
             throw Utils::LoadingException("items.json", true);
         }
 
-        itemsJsonFile >> itemsJson;
+        *itemsJsonFile >> itemsJson;
 
         for(auto itor = itemsJson.begin(); itor != itemsJson.end(); ++itor) {
             std::vector<std::unique_ptr<ItemEffect>> effects; //0 is opmon, 1 is player, 2 is held
@@ -105,22 +111,41 @@ namespace OpMon {
 
         //Maps initialisation
 
+        if(!uidata->getOptions().checkParam("mapsmemory")) {
+            uidata->getOptions().addParam("mapsmemory", std::to_string(DEFAULT_MAPS_MEMORY));
+        }
+        try {
+            mapsMemoryBudget = std::stoul(uidata->getOptions().getParam("mapsmemory").getValue()) * 1024;
+        } catch(std::exception &) {
+            Utils::Log::warn("Invalid mapsmemory option, using the default value.");
+            mapsMemoryBudget = DEFAULT_MAPS_MEMORY * 1024;
+        }
+
         //The maps and the trainers' data are stored in two separate files
-        std::ifstream mapsJsonFile(Path::getResourcePath() + "data/maps.json");
-        std::ifstream trainersJsonFile(Path::getResourcePath() + "data/trainers.json");
+        std::string mapsPath = Path::getResourcePath() + "data/maps.json";
+        std::string packPath = Path::getResourcePath() + "data/maps.pack";
+        std::unique_ptr<std::istream> trainersJsonFile = Utils::ResourceLoader::openFile("data/trainers.json");
 
-        if(!mapsJsonFile) {
-            throw Utils::LoadingException(Path::getResourcePath() + "data/maps.json");
-        }
         if(!trainersJsonFile){
             throw Utils::LoadingException(Path::getResourcePath() + "data/trainers.json");
         }
 
-        nlohmann::json mapsJson;
+        //The compiled maps are used if they are more recent than the json file
+        std::error_code error;
+        if(std::filesystem::exists(packPath, error)) {
+            if(std::filesystem::exists(mapsPath, error) && std::filesystem::last_write_time(packPath, error) < std::filesystem::last_write_time(mapsPath, error)) {
+                Utils::Log::warn("data/maps.pack is older than data/maps.json, and won't be used. Compile it again with --compile-maps.");
+            } else if(mapPack.open(packPath)) {
+                for(std::size_t i = 0; i < mapPack.getMapCount(); i++) {
+                    maps.emplace(mapPack.getId(i), new Elements::Map(&mapPack, i));
+                }
+                Utils::Log::oplog("Loaded the index of data/maps.pack");
+            }
+        }
+
         nlohmann::json trainersJson;
 
-        mapsJsonFile >> mapsJson;
-        trainersJsonFile >> trainersJson;
+        *trainersJsonFile >> trainersJson;
 
         /* Trainers loading */
         for(auto itor = trainersJson.begin(); itor != trainersJson.end(); ++itor) {
@@ -143,8 +168,16 @@ namespace OpMon {
         completions.emplace("playername", player->getNameP());
 
         /* Maps loading */
-        for(auto itor = mapsJson.begin(); itor != mapsJson.end(); ++itor) {
-            maps.emplace(itor->at("id"), new Elements::Map(*itor));
+        if(maps.empty()) {
+            //Only the position of each map in the file is read here, each map is parsed when it is loaded.
+            //The file isn't in the resource archive : it is mapped like data/maps.pack
+            if(!mapsJsonFile.open(mapsPath)) {
+                throw Utils::LoadingException(mapsPath);
+            }
+            std::string_view mapsSource(mapsJsonFile.getData(), mapsJsonFile.getSize());
+            for(Utils::JsonIndex::Entry const &entry : Utils::JsonIndex::indexArray(mapsSource, "id")) {
+                maps.emplace(entry.key, new Elements::Map(entry.source));
+            }
         }
 
         mapsItor = maps.begin();
@@ -159,33 +192,108 @@ namespace OpMon {
 
     Elements::Map *OverworldData::getMap(std::string const &map) {
         if(!maps[map]->isLoaded()) {
-            Elements::Map *newMap = maps[map]->loadMap(*this);
-            delete(maps[map]);
-            maps[map] = newMap;
+            return addLoadedMap(map, loadMap(*maps[map]));
+        } else if(!loadedMaps.empty() && loadedMaps.front().first != map) {
+            //Moves the map at the beginning of the list
+            for(auto itor = loadedMaps.begin(); itor != loadedMaps.end(); ++itor) {
+                if(itor->first == map) {
+                    loadedMaps.splice(loadedMaps.begin(), loadedMaps, itor);
+                    break;
+                }
+            }
         }
         return maps[map];
     }
 
+    Elements::Map *OverworldData::getUnloadedCopy(std::string const &map) {
+        Elements::Map *unloadedMap = maps.at(map);
+        return unloadedMap->isLoaded() ? nullptr : unloadedMap->unloadMap();
+    }
+
+    Elements::Map *OverworldData::loadMap(Elements::Map const &unloadedMap) {
+        std::unique_lock<std::mutex> lock(loadingMutex, std::defer_lock);
+        if(Utils::MainThread::isMainThread()) {
+            //The thread holding the lock may be waiting for the main thread (see Utils::MainThread::run)
+            while(!lock.try_lock()) {
+                Utils::MainThread::processTasks(std::chrono::milliseconds(1));
+            }
+        } else {
+            lock.lock();
+        }
+        loadingTextures.clear();
+        std::unique_ptr<Elements::Map> map;
+        try {
+            map.reset(unloadedMap.loadMap(*this));
+        } catch(...) {
+            loadingTextures.clear();
+            throw;
+        }
+        for(std::string const &element : map->getAnimatedElements()) {
+            getEventsTexture(element);
+        }
+        //The frames loaded with the map are put in the same textures, so its events can be drawn together
+        spritesAtlas.pack();
+        map->setTextures(std::move(loadingTextures));
+        loadingTextures.clear();
+        return map.release();
+    }
+
+    Elements::Map *OverworldData::addLoadedMap(std::string const &id, Elements::Map *map) {
+        Elements::Map *&current = maps.at(id);
+        if(current->isLoaded()) {
+            delete(map);
+            return current;
+        }
+        delete(current);
+        current = map;
+
+        auto states = eventsStates.find(id);
+        if(states != eventsStates.end()) {
+            map->setEventsState(states->second);
+            eventsStates.erase(states);
+        }
+        loadedMaps.emplace_front(id, map->getMemorySize());
+        mapsMemory += loadedMaps.front().second;
+        return map;
+    }
+
+    void OverworldData::trimMaps() {
+        auto itor = loadedMaps.end();
+        while(mapsMemory > mapsMemoryBudget && itor != loadedMaps.begin()) {
+            --itor;
+            if(itor->first == player->getMapId()) {
+                continue;
+            }
+            Elements::Map *&map = maps[itor->first];
+            std::map<std::size_t, nlohmann::json> states = map->getEventsState();
+            if(!states.empty()) {
+                eventsStates[itor->first] = std::move(states);
+            }
+            Elements::Map *unloadedMap = map->unloadMap();
+            delete(map);
+            map = unloadedMap;
+
+            Utils::Log::oplog("Unloaded " + itor->first);
+            mapsMemory -= itor->second;
+            itor = loadedMaps.erase(itor);
+        }
+    }
+
     Elements::Map *OverworldData::getCurrentMap() {
         return getMap(player->getMapId());
     }
 
-    std::vector<sf::Texture> &OverworldData::getEventsTexture(std::string const &key) { //Uncomment commented lines when C++20 is commonly used
-        //#if __cplusplus > 201703L
-    	//if(!eventsTextures.contains(key)){
-        //#else
-    	bool contains = false;
-    	for(std::pair<std::string, std::vector<sf::Texture> > pair : eventsTextures){
-    		if(pair.first == key) {
-    			contains = true;
-    			break;
-    		}
-    	}
-    	if(contains){
-            //#endif
-    		Utils::Log::warn("Event texture key " + key + " not found. Returning alpha.");
-    		return eventsTextures["alpha"];
-    	}else return eventsTextures[key];
+    const Ui::Frames &OverworldData::getEventsTexture(std::string const &key) {
+        auto itor = loadingTextures.find(key);
+        if(itor != loadingTextures.end()) {
+            return *itor->second;
+        }
+        std::shared_ptr<const Ui::Frames> frames = spritesAtlas.acquire(key);
+        if(!frames) {
+            Utils::Log::warn("Event texture key " + key + " not found. Returning alpha.");
+            return alpha;
+        }
+        return *loadingTextures.emplace(key, std::move(frames)).first->second;
     }
 
 } // namespace OpMon
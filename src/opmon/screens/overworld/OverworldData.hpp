@@ -6,9 +6,13 @@
 #pragma once
 
 #include <SFML/Graphics/Rect.hpp>
+#include <list>
+#include <mutex>
 
+#include "src/utils/MappedFile.hpp"
 #include "src/utils/defines.hpp"
 #include "src/opmon/view/elements/Map.hpp"
+#include "src/opmon/view/ui/TextureAtlas.hpp"
 #include "src/opmon/screens/gamemenu/GameMenuData.hpp"
 
 namespace sf {
@@ -28,14 +32,46 @@ class Map;
      */
     class OverworldData {
     private:
-        sf::Texture alpha = sf::Texture();
-        std::vector<sf::Texture> alphaTab = std::vector<sf::Texture>(1);
+        /*!
+         * \brief The frames returned for an unknown texture key : a single empty frame, without texture.
+         */
+        Ui::Frames alpha{nullptr, {sf::IntRect(0, 0, 0, 0)}};
 
         std::map<std::string, OpTeam *> trainers;
 
+        /*!
+         * \brief The compiled maps, if `data/maps.pack` is up to date. Must stay open as long as the maps exist.
+         */
+        Elements::MapPack mapPack;
+        /*!
+         * \brief `data/maps.json`, if the maps aren't loaded from the pack. The unloaded maps point in it.
+         */
+        Utils::MappedFile mapsJsonFile;
+
         std::map<std::string, Elements::Map *> maps;
         std::map<std::string, Elements::Map *>::iterator mapsItor;
 
+        /*!
+         * \brief The loaded maps with their memory size (see Elements::Map::getMemorySize), from the most recently used to the least recently used.
+         */
+        std::list<std::pair<std::string, std::size_t>> loadedMaps;
+        /*!
+         * \brief The memory used by the loaded maps, in bytes.
+         */
+        std::size_t mapsMemory = 0;
+        /*!
+         * \brief The memory the loaded maps can use before being unloaded, in bytes. Set with the option `mapsmemory`, in kilobytes.
+         */
+        std::size_t mapsMemoryBudget;
+        /*!
+         * \brief The persistent state of the events of the unloaded maps (see Elements::Map::getEventsState).
+         */
+        std::map<std::string, std::map<std::size_t, nlohmann::json>> eventsStates;
+        /*!
+         * \brief Locked while a map is loaded, since the events of a map being loaded by another thread use the data (see OverworldData::loadMap).
+         */
+        std::mutex loadingMutex;
+
         sf::Texture texturePP;
         sf::IntRect texturePPRect[4];
         sf::IntRect walkingPPRect[4];
@@ -47,9 +83,15 @@ class Map;
 
         std::map<std::string, sf::Vector2f> elementsPos;
         std::map<std::string, unsigned int> elementsCounter;
-        std::map<std::string, std::vector<sf::Texture>> elementsTextures;
 
-        std::map<std::string, std::vector<sf::Texture>> eventsTextures;
+        /*!
+         * \brief The frames of the events and of the animated elements, packed in a few textures. They are loaded when a map using them is loaded.
+         */
+        Ui::TextureAtlas spritesAtlas;
+        /*!
+         * \brief The frames acquired by the map being loaded, given to the map at the end of OverworldData::loadMap.
+         */
+        std::map<std::string, std::shared_ptr<const Ui::Frames>> loadingTextures;
 
         std::map<std::string, std::unique_ptr<Item>> itemsList;
 
@@ -75,33 +117,28 @@ class Map;
          * \brief Gets the animation counter for an element.
          */
         unsigned int getElementCounter(std::string const &id) { return elementsCounter[id]; }
-        /*!
-         * \brief Gets the textures of an element.
-         */
-        std::vector<sf::Texture> &getElementTextures(std::string const &id) { return elementsTextures[id]; }
         /*!
          * \brief Gets the position of an element.
          */
         sf::Vector2f &getElementPos(std::string const &id) { return elementsPos[id]; }
-        /*!
-         * \brief Gets the current shown texture of an element.
-         */
-        sf::Texture &getCurrentElementTexture(std::string const &id) { return elementsTextures[id][elementsCounter[id]]; }
 
         /*!
          * \brief Gets the textures of a character.
          * \deprecated Use getEventsTexture, charaTextures have been merged with eventsTextures.
          */
-        OP_DEPRECATED std::vector<sf::Texture> &getCharaTexture(std::string const &key) { return eventsTextures[key]; }
+        OP_DEPRECATED const Ui::Frames &getCharaTexture(std::string const &key) { return getEventsTexture(key); }
         /*!
          * \brief Gets the textures of a door.
          * \deprecated Use getEventsTexture, doorsTextures have been merged with eventsTextures.
          */
-        OP_DEPRECATED std::vector<sf::Texture> &getDoorsTexture(std::string const &key) { return eventsTextures[key]; }
+        OP_DEPRECATED const Ui::Frames &getDoorsTexture(std::string const &key) { return getEventsTexture(key); }
         /*!
-         * \brief Gets the textures of an event.
+         * \brief Gets the frames of an event, and loads them if needed.
+         * \details Must be called while a map is loaded (see OverworldData::loadMap) : the frames stay loaded as long as this map is loaded.
+         * The frames loaded by this call are empty until the end of the loading.
+         * \returns The frames of the given key, or an empty frame if the key is unknown.
          */
-        std::vector<sf::Texture> &getEventsTexture(std::string const &key);
+        const Ui::Frames &getEventsTexture(std::string const &key);
 
         /*!
          * \brief Gets a completion.
@@ -128,6 +165,30 @@ class Map;
          */
         Elements::Map *getCurrentMap();
 
+        /*!
+         * \brief Returns an unloaded copy of a map, to be loaded by another thread with OverworldData::loadMap.
+         * \returns The copy, which must be deleted by the caller, or `nullptr` if the map is already loaded.
+         */
+        Elements::Map *getUnloadedCopy(std::string const &map);
+        /*!
+         * \brief Loads an unloaded map (see Elements::Map::loadMap). Can be called from any thread.
+         * \details Only one map is loaded at a time. The frames used by the events and the animated elements of the map are loaded with it. The returned map must be given to OverworldData::addLoadedMap, or deleted.
+         */
+        Elements::Map *loadMap(Elements::Map const &unloadedMap);
+        /*!
+         * \brief Replaces an unloaded map by a map loaded with OverworldData::loadMap.
+         * \details If the map has been loaded in the meantime, the given map is deleted.
+         * \returns The loaded map.
+         */
+        Elements::Map *addLoadedMap(std::string const &id, Elements::Map *map);
+
+        /*!
+         * \brief Unloads the least recently used maps until the loaded maps fit in the memory budget.
+         * \details The current map is never unloaded. The persistent state of the events is kept, and given back to the events when the map is loaded again.
+         * Must only be called when no pointer to a map other than the current one is used, since they may be deleted.
+         */
+        void trimMaps();
+
         /*!
          * \brief Gets the id of the map currently pointer by the map iterator.
          * \details The map iterator is used to go through all the maps in debug mode.
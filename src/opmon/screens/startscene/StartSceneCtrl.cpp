@@ -90,10 +90,10 @@ namespace OpMon {
             _next_gs = std::make_unique<OverworldCtrl>(data.getPlayer(), data.getUiDataPtr());
             break;
         case LOAD_ANIMATION_OPEN:
-            _next_gs = std::make_unique<AnimationCtrl>(std::make_unique<Animations::WinAnim>(screenTexture, true));
+            _next_gs = std::make_unique<AnimationCtrl>(std::make_unique<Animations::WinAnim>(screenTexture, true, data.getWindowFrames()));
             break;
         case LOAD_ANIMATION_CLOSE:
-            _next_gs = std::make_unique<AnimationCtrl>(std::make_unique<Animations::WinAnim>(screenTexture, false));
+            _next_gs = std::make_unique<AnimationCtrl>(std::make_unique<Animations::WinAnim>(screenTexture, false, data.getWindowFrames()));
             break;
         default:
             throw Utils::UnexpectedValueException(std::to_string(loadNext), "a view to load in StartSceneCtrl::loadNextScreen()");
@@ -104,13 +104,15 @@ namespace OpMon {
         //If the player have finished to enter his/her name, animNext must have been set to true. This part will launch the animation.
         if(animNext) {
             animNext = false;
-            frame.draw(view);
+            if(renderEnabled) {
+                frame.draw(view);
+            }
             loadNext = LOAD_ANIMATION_CLOSE;
-            screenTexture = frame.getTexture();
+            screenTexture = std::make_shared<const sf::Texture>(frame.getTexture());
             return GameStatus::NEXT_NLS;
         }
         GameStatus toReturn = view.update();
-        if(toReturn == GameStatus::CONTINUE) {
+        if(toReturn == GameStatus::CONTINUE && renderEnabled) {
             frame.draw(view);
         }
 
@@ -118,7 +120,7 @@ namespace OpMon {
             switch(view.getPart()) {
             case 1:
                 loadNext = LOAD_ANIMATION_OPEN;
-                screenTexture = frame.getTexture();
+                screenTexture = std::make_shared<const sf::Texture>(frame.getTexture());
                 toReturn = GameStatus::NEXT_NLS;
                 break;
             case 3:
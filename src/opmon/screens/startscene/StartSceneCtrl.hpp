@@ -49,7 +49,7 @@ class UiData;
          * \brief A screenshot.
          * \details A screenshot of the frame is taken in update(sf::RenderTexture&). It is used as a background for the opening and closing animations before and after the input part of the introduction.
          */
-        sf::Texture screenTexture;
+        std::shared_ptr<const sf::Texture> screenTexture;
 
     public:
         StartSceneCtrl(UiData *data);
@@ -6,9 +6,13 @@
 
 #include "StartSceneData.hpp"
 
+#include <array>
+#include <future>
 #include <memory>
 
+#include "src/utils/ResourceCache.hpp"
 #include "src/utils/ResourceLoader.hpp"
+#include "src/utils/threadpool.hpp"
 #include "src/opmon/core/Player.hpp"
 #include "src/opmon/model/Enums.hpp"
 #include "src/opmon/view/elements/Position.hpp"
@@ -19,9 +23,19 @@ class UiData;
     StartSceneData::StartSceneData(UiData *data)
         : uidata(data)
         , player(new Player()) {
-        Utils::ResourceLoader::load(background, "backgrounds/start/startscene.png");
-        Utils::ResourceLoader::load(prof, "sprites/chara/prof/profkiwai.png");
-        Utils::ResourceLoader::load(nameBg, "backgrounds/start/nameEntry.png");
+        //All the textures are loaded in parallel
+        std::array<std::future<std::shared_ptr<const sf::Texture>>, 6> framesLoading;
+        for(std::size_t i = 0; i < framesLoading.size(); i++) {
+            framesLoading[i] = Utils::ResourceCache::loadTexture("animations/winChange/animWindowFrame" + std::to_string(i + 1) + ".png");
+        }
+        Utils::TextureBatch textures;
+        textures.add(background, "backgrounds/start/startscene.png");
+        textures.add(prof, "sprites/chara/prof/profkiwai.png");
+        textures.add(nameBg, "backgrounds/start/nameEntry.png");
+        textures.wait();
+        for(std::size_t i = 0; i < windowFrames.size(); i++) {
+            windowFrames[i] = Utils::ThreadPool::wait(framesLoading[i]);
+        }
 
         //Player initalization
         player->setMapID("Player's room");
@@ -5,6 +5,9 @@
  */
 #pragma once
 
+#include <array>
+#include <memory>
+
 #include "src/opmon/core/Player.hpp"
 #include "src/opmon/core/UiData.hpp"
 
@@ -20,6 +23,10 @@ class UiData;
         sf::Texture background;
         sf::Texture prof;
         sf::Texture nameBg;
+        /*!
+         * \brief The frames of the window animation (see Animations::WinAnim), kept loaded between the transitions.
+         */
+        std::array<std::shared_ptr<const sf::Texture>, 6> windowFrames;
 
         UiData *uidata;
 
@@ -55,6 +62,10 @@ class UiData;
          * \brief Gets the background of the name entry screen.
          */
         sf::Texture &getNameBg() { return nameBg; }
+        /*!
+         * \brief Gets the frames of the window animation.
+         */
+        std::array<std::shared_ptr<const sf::Texture>, 6> const &getWindowFrames() const { return windowFrames; }
         /*!
          * \brief Initialises all the data.
          * \param ptr A pointer to the UiData object.
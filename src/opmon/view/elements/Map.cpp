@@ -6,10 +6,10 @@ File under GNU GPL v3.0 license
  */
 #include "Map.hpp"
 
-#include <cstdlib>
 #include <sstream>
 
 #include "../../../utils/log.hpp"
+#include "../../../utils/profiler.hpp"
 #include "src/opmon/screens/overworld/OverworldData.hpp"
 #include "src/nlohmann/json.hpp"
 #include "events/metaevents.hpp"
@@ -21,6 +21,9 @@ File under GNU GPL v3.0 license
 #include "events/AnimationEvent.hpp"
 #include "events/SoundEvent.hpp"
 
+//Approximate size of an event with its sprite, in bytes
+#define EVENT_MEMORY_SIZE 512
+
 namespace sf {
 	class String;
 }  // namespace sf
@@ -28,24 +31,45 @@ namespace sf {
 namespace OpMon {
 	namespace Elements {
 
-		Map::Map(std::vector<int> const &layer1, std::vector<int> const &layer2, std::vector<int> const &layer3, int w, int h, bool indoor, std::string const &bg, std::vector<std::string> const &animatedElements)
+		Map::Map(std::vector<int> const &layer1, std::vector<int> const &layer2, std::vector<int> const &layer3, int w, int h, bool indoor, std::string const &bg, std::vector<TilesetRange> const &tilesets, std::vector<std::string> const &animatedElements)
 		: indoor(indoor)
 		, bg(bg)
+		, w(w)
+		, h(h)
 		, animatedElements(animatedElements)
-		, loaded(true) {
-
-			this->layer1 = (int *)malloc(sizeof(int) * w * h);
-			this->layer2 = (int *)malloc(sizeof(int) * w * h);
-			this->layer3 = (int *)malloc(sizeof(int) * w * h);
+		, loaded(true)
+		, tilesets(tilesets) {
 
+			tiles.resize(3 * w * h);
 			for(unsigned int i = 0; i < ((unsigned int)w * h); i++) {
-				this->layer1[i] = layer1[i];
-				this->layer2[i] = layer2[i];
-				this->layer3[i] = layer3[i];
+				tiles[i] = layer1[i];
+				tiles[w * h + i] = layer2[i];
+				tiles[2 * w * h + i] = layer3[i];
 			}
+			//The third layer is compressed from the end of the tiles, which are then dropped
+			this->layer3 = TileLayer(std::span(tiles).subspan(2 * w * h));
+			tiles.resize(2 * w * h);
+			tiles.shrink_to_fit();
+			this->layer1 = tiles.data();
+			this->layer2 = tiles.data() + w * h;
+
+			eventsIndex.resize(w * h);
+			bakeCollisions();
+		}
 
-			this->w = w;
-			this->h = h;
+		Map::Map(MapRecord const &record)
+		: layer1(record.layers[0])
+		, layer2(record.layers[1])
+		, layer3(std::span(record.layers[2], (std::size_t)record.w * record.h))
+		, indoor(record.indoor)
+		, bg(record.music)
+		, w(record.w)
+		, h(record.h)
+		, animatedElements(record.animations)
+		, loaded(true)
+		, tilesets(record.tilesets)
+		, collisions(record.collisions) {
+			eventsIndex.resize(w * h);
 		}
 
 		Map::~Map() {
@@ -53,43 +77,55 @@ namespace OpMon {
 				for(AbstractEvent *event : events) {
 					delete(event);
 				}
-				free(layer1);
-				free(layer2);
-				free(layer3);
 			}
 		}
 
-		Map::Map(nlohmann::json jsonData)
-		: jsonData(jsonData)
+		Map::Map(std::string_view jsonSource)
+		: jsonSource(jsonSource)
+		, loaded(false) {
+		}
+
+		Map::Map(const MapPack *pack, std::size_t index)
+		: pack(pack)
+		, packIndex(index)
 		, loaded(false) {
 		}
 
-		Map *Map::loadMap(OverworldData &data) {
+		Map *Map::loadMap(OverworldData &data) const {
+			Utils::Profiler::Zone zone("Map::loadMap");
 			if(!loaded) {
+				Map *currentMap;
+				if(pack != nullptr) {
+					Utils::Log::oplog("Loading " + pack->getId(packIndex));
+					MapRecord record = pack->readMap(packIndex);
+					currentMap = new Map(record);
+					currentMap->pack = pack;
+					currentMap->packIndex = packIndex;
+					for(std::span<const char> event : record.events) {
+						currentMap->addEvent(data, nlohmann::json::from_msgpack(event.data(), event.data() + event.size()));
+					}
+					currentMap->buildAtlas();
+					return currentMap;
+				}
+
+				nlohmann::json jsonData = nlohmann::json::parse(jsonSource.begin(), jsonSource.end());
 				std::string mapName = jsonData.at("id");
 				Utils::Log::oplog("Loading " + mapName);
-				Map *currentMap = new Map(jsonData.at("layers")[0],
+				currentMap = new Map(jsonData.at("layers")[0],
 						jsonData.at("layers")[1],
 						jsonData.at("layers")[2],
 						jsonData.at("size")[0],
 						jsonData.at("size")[1],
 						jsonData.at("indoor"),
 						jsonData.at("music"),
+						readTilesets(jsonData),
 						jsonData.value("animations", std::vector<std::string>()));
+				currentMap->jsonSource = jsonSource;
 
-				for(nlohmann::json event : jsonData.at("events")){
-					std::string type = event.at("type");
-					if(type == "TP") currentMap->addEvent(new TPEvent(data, event));
-					else if(type == "Animation") currentMap->addEvent(new AnimationEvent(data, event));
-					else if(type == "Character") currentMap->addEvent(new CharacterEvent(data, event));
-					else if(type == "Dialog") currentMap->addEvent(new DialogEvent(data, event));
-					else if(type == "Sound") currentMap->addEvent(new SoundEvent(data, event));
-					else if(type == "Battle") currentMap->addEvent(new BattleEvent(data, event));
-					else if(type == "Trainer") currentMap->addEvent(new TrainerEvent(data, event));
-					else if(type == "TalkingCharacter") currentMap->addEvent(new TalkingCharaEvent(data, event));
-					else if(type == "Door") currentMap->addEvent(new DoorEvent(data, event));
-					else if(type == "LinearMeta") currentMap->addEvent(new LinearMetaEvent(data, event));
+				for(nlohmann::json const &event : jsonData.at("events")){
+					currentMap->addEvent(data, event);
 				}
+				currentMap->buildAtlas();
 				return currentMap;
 			} else {
 				Utils::Log::warn("Trying to load an already loaded map.");
@@ -97,30 +133,100 @@ namespace OpMon {
 			}
 		}
 
-		std::list<AbstractEvent *> Map::getEvent(sf::Vector2i position) const {
-			if(loaded) {
-				std::list<AbstractEvent *> toReturn;
+		Map *Map::unloadMap() const {
+			if(pack != nullptr) {
+				return new Map(pack, packIndex);
+			}
+			return new Map(jsonSource);
+		}
 
-				for(AbstractEvent *event : events) {
-					if(event->getPositionMap().getPosition().x == position.x && event->getPositionMap().getPosition().y == position.y) {
-						toReturn.push_back(event);
-					}
+		std::size_t Map::getMemorySize() const {
+			return sizeof(Map) + tiles.size() * sizeof(std::uint16_t) + layer3.getMemorySize() + collisionsStorage.size()
+				+ eventsIndex.size() * sizeof(std::vector<AbstractEvent *>) + events.size() * (2 * sizeof(AbstractEvent *) + EVENT_MEMORY_SIZE)
+				+ (atlas ? (std::size_t)atlas->getTexture().getSize().x * atlas->getTexture().getSize().y * 4 : 0);
+		}
+
+		std::map<std::size_t, nlohmann::json> Map::getEventsState() const {
+			std::map<std::size_t, nlohmann::json> states;
+			for(std::size_t i = 0; i < events.size(); i++) {
+				nlohmann::json state = events[i]->getPersistentState();
+				if(!state.is_null()) {
+					states.emplace(i, std::move(state));
+				}
+			}
+			return states;
+		}
+
+		void Map::setEventsState(std::map<std::size_t, nlohmann::json> const &states) {
+			for(auto const &state : states) {
+				if(state.first < events.size()) {
+					events[state.first]->setPersistentState(state.second);
 				}
-				return toReturn;
+			}
+		}
+
+		void Map::addEvent(OverworldData &data, nlohmann::json const &event) {
+			std::string type = event.at("type");
+			if(type == "TP") addEvent(new TPEvent(data, event));
+			else if(type == "Animation") addEvent(new AnimationEvent(data, event));
+			else if(type == "Character") addEvent(new CharacterEvent(data, event));
+			else if(type == "Dialog") addEvent(new DialogEvent(data, event));
+			else if(type == "Sound") addEvent(new SoundEvent(data, event));
+			else if(type == "Battle") addEvent(new BattleEvent(data, event));
+			else if(type == "Trainer") addEvent(new TrainerEvent(data, event));
+			else if(type == "TalkingCharacter") addEvent(new TalkingCharaEvent(data, event));
+			else if(type == "Door") addEvent(new DoorEvent(data, event));
+			else if(type == "LinearMeta") addEvent(new LinearMetaEvent(data, event));
+		}
+
+		void Map::addEvent(AbstractEvent *event) {
+			events.push_back(event);
+			sf::Vector2i position = event->getPositionMap().getPosition();
+			if(position.x >= 0 && position.x < w && position.y >= 0 && position.y < h) {
+				eventsIndex[position.x + position.y * w].push_back(event);
+			} else {
+				Utils::Log::warn("Event out of the map's bounds (" + std::to_string(position.x) + ", " + std::to_string(position.y) + ")");
+			}
+		}
+
+		std::span<AbstractEvent *const> Map::getEvent(sf::Vector2i position) const {
+			if(loaded) {
+				if(position.x < 0 || position.x >= w || position.y < 0 || position.y >= h) {
+					return std::span<AbstractEvent *const>();
+				}
+				return eventsIndex[position.x + position.y * w];
 			} else {
 				throw Utils::UnloadedResourceException("Map", "Map::getEvent");
 			}
 		}
 
+		void Map::updateEventTile(sf::Vector2i oldPosition) {
+			if(!loaded || oldPosition.x < 0 || oldPosition.x >= w || oldPosition.y < 0 || oldPosition.y >= h) {
+				return;
+			}
+			std::vector<AbstractEvent *> &tile = eventsIndex[oldPosition.x + oldPosition.y * w];
+			for(auto itor = tile.begin(); itor != tile.end();) {
+				sf::Vector2i position = (*itor)->getPositionMap().getPosition();
+				if(position == oldPosition) {
+					++itor;
+					continue;
+				}
+				if(position.x >= 0 && position.x < w && position.y >= 0 && position.y < h) {
+					eventsIndex[position.x + position.y * w].push_back(*itor);
+				}
+				itor = tile.erase(itor);
+			}
+		}
+
 		int Map::getCurrentTileCode(sf::Vector2i const &pos, int layer) const {
 			if(loaded) {
 				switch(layer) {
 				case 1:
-					return layer1[pos.x + pos.y * w] == 0 ? 257 /*"official" void tile*/ : layer1[pos.x + pos.y * w] - 1;
+					return layer1[pos.x + pos.y * w];
 				case 2:
-					return layer2[pos.x + pos.y * w] == 0 ? 257 /*"official" void tile*/ : layer2[pos.x + pos.y * w] - 1;
+					return layer2[pos.x + pos.y * w];
 				case 3:
-					return layer3[pos.x + pos.y * w] == 0 ? 257 /*"official" void tile*/ : layer3[pos.x + pos.y * w] - 1;
+					return layer3[pos.x + pos.y * w];
 				default:
 					throw Utils::UnexpectedValueException(std::to_string(layer), "a layer between 1 and 3 in Map::getCurrentTileCode", false);
 					return 0;
@@ -132,33 +238,56 @@ namespace OpMon {
 
 		int Map::getTileCollision(int tile) const {
 			if(loaded) {
-				return colTile[tile];
+				const TilesetRange *range = findTileset(tilesets, tile);
+				return range == nullptr ? 0 : range->tileset->getCollision(tile - range->firstGid);
 			} else {
 				throw Utils::UnloadedResourceException("Map", "Map::getTileCollision");
 			}
 		}
 
+		void Map::buildAtlas() {
+			std::size_t tilesCount = (std::size_t)w * h;
+			std::vector<std::uint16_t> tiles3 = layer3.decompress();
+			atlas = std::make_shared<const TileAtlas>(tilesets, std::initializer_list<std::span<const std::uint16_t>>{
+					std::span(layer1, tilesCount), std::span(layer2, tilesCount), std::span<const std::uint16_t>(tiles3)});
+		}
+
 		int Map::getCollision(sf::Vector2i const &pos) const {
 			if(loaded) {
-				int collisionLayer1 = getTileCollision(getCurrentTileCode(pos, 1));
-				int collisionLayer2 = getTileCollision(getCurrentTileCode(pos, 2));
-
-				//TODO : factorise if possible (I don't like all these return statements)
-				if(collisionLayer1 == 0) {
-					return collisionLayer2;
-				}
-				if(collisionLayer2 == 0) {
-					return collisionLayer1;
-				}
-				if(collisionLayer1 == 1 || collisionLayer2 == 1) {
-					return 1;
-				}
-				return collisionLayer1;
+				return COLLISION_CODE(getCollisionFlags(pos));
 			} else {
 				throw Utils::UnloadedResourceException("Map", "Map::getCollision");
 			}
 		}
 
+		void Map::bakeCollisions() {
+			collisionsStorage.resize(w * h);
+			sf::Vector2i pos;
+			for(pos.y = 0; pos.y < h; pos.y++) {
+				for(pos.x = 0; pos.x < w; pos.x++) {
+					int collisionLayer1 = getTileCollision(getCurrentTileCode(pos, 1));
+					int collisionLayer2 = getTileCollision(getCurrentTileCode(pos, 2));
+
+					//If one of the layers blocks the player, it's prioritary.
+					int collision = collisionLayer1;
+					if(collisionLayer1 == 0) {
+						collision = collisionLayer2;
+					} else if(collisionLayer2 != 0 && (collisionLayer1 == 1 || collisionLayer2 == 1)) {
+						collision = 1;
+					}
+
+					//A tile can be entered if both layers are free, or are ledges going in the direction of the movement (5 : right, 6 : left, 7 : down, 8 : up).
+					auto passable = [collisionLayer1, collisionLayer2](int ledge) {
+						return (collisionLayer1 == 0 || collisionLayer1 == ledge) && (collisionLayer2 == 0 || collisionLayer2 == ledge);
+					};
+					std::uint8_t flags = (passable(8) ? PASS_UP : 0) | (passable(7) ? PASS_DOWN : 0) | (passable(6) ? PASS_LEFT : 0) | (passable(5) ? PASS_RIGHT : 0);
+
+					collisionsStorage[pos.x + pos.y * w] = (std::uint8_t)(collision << 4) | flags;
+				}
+			}
+			collisions = collisionsStorage.data();
+		}
+
 		std::string Map::toDebugString() {
 			std::ostringstream out;
 			out << "[class Map]" << std::endl;
@@ -167,90 +296,15 @@ namespace OpMon {
 				out << "size : " << w << " ; " << h << std::endl;
 				out << "bg = " << bg << std::endl;
 				out << "indoor = " << indoor << std::endl;
-				out << "layer1 size : " << sizeof(layer1) / 4 << std::endl;
-				out << "layer2 size : " << sizeof(layer2) / 4 << std::endl;
-				out << "layer3 size : " << sizeof(layer3) / 4 << std::endl;
+				out << "layers size : " << w * h << std::endl;
+				out << "from pack : " << tiles.empty() << std::endl;
 				out << "event count : " << events.size() << std::endl;
 				out << "animated elements count : " << animatedElements.size() << std::endl;
 			} else {
-				out << "Json object : " << std::endl;
-				out << jsonData << std::endl;
+				out << "Json source size : " << jsonSource.size() << std::endl;
 			}
 			return out.str();
 		}
 
-#define FILL_VOID 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-
-		int Map::colTile[4096] = {
-				0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, FILL_VOID, //The last tile of this line allows to make invisible walls
-				0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, FILL_VOID, //1
-				0, 0, 1, 1, 1, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, FILL_VOID,
-				2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 8, 8, 8, 0, 0, 0, FILL_VOID,
-				2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5, 7, 7, 7, 0, 0, 0, FILL_VOID,
-				2, 2, 2, 2, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 6, 5, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, FILL_VOID,
-				0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 6, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID, //16
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, FILL_VOID, //32
-				1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 1, 0, 1, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID, //48
-				1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
-				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID //63
-				//0  1  2  3  4  5  6  7  8  9  10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 +35
-
-		};
-
-#undef FILL_VOID
-
 	} // namespace Elements
 } // namespace OpMon
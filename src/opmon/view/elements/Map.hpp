@@ -15,9 +15,29 @@
 #define MAP_HPP
 
 #include <SFML/Graphics/RenderTexture.hpp>
-#include <list>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
 
 #include "../../../nlohmann/json.hpp"
+#include "MapPack.hpp"
+#include "TileLayer.hpp"
+#include "Tileset.hpp"
+#include "src/opmon/view/ui/TextureAtlas.hpp"
+
+//Bits of the collision grid (see Map::getCollisionFlags) telling if a tile can be entered while going in a direction.
+#define PASS_UP 0x01
+#define PASS_DOWN 0x02
+#define PASS_LEFT 0x04
+#define PASS_RIGHT 0x08
+#define PASS_ALL (PASS_UP | PASS_DOWN | PASS_LEFT | PASS_RIGHT)
+/*!
+ * \brief Gets the collision code (as returned by Map::getCollision) from a byte of the collision grid.
+ */
+#define COLLISION_CODE(flags) ((flags) >> 4)
 
 namespace sf {
 class RenderTexture;
@@ -33,14 +53,24 @@ namespace OpMon {
 
         /*!
          * \brief Defines a specific place in a game, containing the event, the animated objects and the map layers.
-         * \details To lower the loading time, a map object can be created without initialisation. The data of the map is stored in Map::jsonData, and the map can then be loaded by calling Map::loadMap. Using an unloaded map will crash the game.
+         * \details To lower the loading time, a map object can be created without initialisation. The map only knows where its data is (its json text in Map::jsonSource, or its record in a MapPack), and the data is read when the map is loaded by calling Map::loadMap. Using an unloaded map will crash the game.
          * \todo Separate the class into MapBuilder (The unloaded map) and Map.
          */
         class Map {
           private:
-            int *layer1;
-            int *layer2;
-            int *layer3;
+            /*!
+             * \brief The two first tile layers. They point either in Map::tiles, or in a MapPack.
+             */
+            const std::uint16_t *layer1 = nullptr;
+            const std::uint16_t *layer2 = nullptr;
+            /*!
+             * \brief The third layer, drawn above the player. Compressed, since it is mostly void.
+             */
+            TileLayer layer3;
+            /*!
+             * \brief The two first layers, one after another, if the map hasn't been loaded from a MapPack.
+             */
+            std::vector<std::uint16_t> tiles;
 
             /*!
              * \brief If `true`, the map is an indoor map.
@@ -55,15 +85,20 @@ namespace OpMon {
             /*!
              * \brief Width of the map.
              */
-            int w;
+            int w = 0;
             /*!
              * \brief Height of the map.
              */
-            int h;
+            int h = 0;
 
             Map(Map const &toCopy) = delete;
 
             std::vector<AbstractEvent *> events;
+            /*!
+             * \brief The events of each tile, indexed by `x + y * w`.
+             * \details Kept up to date when an event changes tile (see Map::updateEventTile), so the events of a tile can be found without going through all the events.
+             */
+            std::vector<std::vector<AbstractEvent *>> eventsIndex;
             /*!
              * \brief Contains the animated elements of the map.
              * \details An animated element is an animation put on the top of the map. For exemple, the wind turbine of Fauxbourg Euvi.
@@ -71,34 +106,76 @@ namespace OpMon {
             std::vector<std::string> animatedElements;
 
             /*!
-             * \brief The map in json for the initialisation.
+             * \brief The json text of the map, parsed when the map is loaded.
+             * \details Points in the memory mapped `data/maps.json`, which must stay open as long as the map isn't loaded.
+             */
+            std::string_view jsonSource;
+            /*!
+             * \brief The pack containing the map, if it isn't loaded from json.
              */
-            nlohmann::json jsonData;
+            const MapPack *pack = nullptr;
+            /*!
+             * \brief The position of the map in Map::pack.
+             */
+            std::size_t packIndex = 0;
             /*!
              * \brief If the map has been loaded or not.
              */
             bool loaded = false;
 
+            /*!
+             * \brief The tilesets used by the layers, sorted by first GID.
+             */
+            std::vector<TilesetRange> tilesets;
+            /*!
+             * \brief The tiles used by the map, built when the map is loaded. Shared with the layers drawing the map (see Ui::MapLayer).
+             */
+            std::shared_ptr<const TileAtlas> atlas;
+            /*!
+             * \brief The frames used by the events and the animated elements of the map, by key. Keeps them loaded as long as the map is loaded (see Ui::TextureAtlas::acquire).
+             */
+            std::map<std::string, std::shared_ptr<const Ui::Frames>> textures;
+
+            /*!
+             * \brief The collision grid of the map, indexed by `x + y * w`.
+             * \details Baked at the creation of the map from the two first layers, or when the pack is compiled. The four low bits are the PASS_* flags, the four high bits are the collision code.
+             * It points either in Map::collisionsStorage, or in a MapPack.
+             */
+            const std::uint8_t *collisions = nullptr;
+            std::vector<std::uint8_t> collisionsStorage;
 
             /*!
-             * \brief The collisions for each tile.
-             *
-             * \todo Add description of each number/collision type.
-             * \todo Move this in a json file and add multiple tileset support.
+             * \brief Fills Map::collisionsStorage and points Map::collisions to it.
              */
-            static int colTile[4096];
+            void bakeCollisions();
 
+            /*!
+             * \brief Builds Map::atlas from the tiles of the layers.
+             */
+            void buildAtlas();
 
           public:
             /*!
              * \brief Creates a map and loads it at the same time, with all the information needed.
              */
-            Map(std::vector<int> const &layer1, std::vector<int> const &layer2, std::vector<int> const &layer3, int w, int h, bool indoor, std::string const &bg, std::vector<std::string> const &animatedElements = std::vector<std::string>());
+            Map(std::vector<int> const &layer1, std::vector<int> const &layer2, std::vector<int> const &layer3, int w, int h, bool indoor, std::string const &bg, std::vector<TilesetRange> const &tilesets, std::vector<std::string> const &animatedElements = std::vector<std::string>());
             /*!
              * \brief Creates a map without loading it.
              * \details If you want to use the map, please call Map::loadMap before calling any other method.
+             * \param jsonSource The json text of the map. It isn't copied : it must stay valid until the map is loaded.
              */
-            Map(nlohmann::json jsonData);
+            Map(std::string_view jsonSource);
+            /*!
+             * \brief Creates a map from a record of a MapPack.
+             * \details The two first layers and the collisions aren't copied : the pack must stay open as long as the map exists. The events aren't added.
+             */
+            Map(MapRecord const &record);
+            /*!
+             * \brief Creates a map without loading it. It will be read from the given pack by Map::loadMap.
+             * \param pack The pack containing the map. It must stay open as long as the map exists.
+             * \param index The position of the map in the pack.
+             */
+            Map(const MapPack *pack, std::size_t index);
             ~Map();
             int getH() const {
                 return h;
@@ -115,13 +192,13 @@ namespace OpMon {
             sf::Vector2i getDimensions() const {
                 return sf::Vector2i(w, h);
             }
-            const int *getLayer1() const {
+            const std::uint16_t *getLayer1() const {
                 return layer1;
             }
-            const int *getLayer2() const {
+            const std::uint16_t *getLayer2() const {
                 return layer2;
             }
-            const int *getLayer3() const {
+            const TileLayer &getLayer3() const {
                 return layer3;
             }
             std::string getBg() const {
@@ -135,14 +212,25 @@ namespace OpMon {
              * \param event A pointer to an event.
              * \warning The given event will be deleted at the destruction of the map.
              */
-            void addEvent(AbstractEvent *event) {
-                events.push_back(event);
-            }
+            void addEvent(AbstractEvent *event);
+            /*!
+             * \brief Creates an event from its json data and adds it to the events of the map.
+             * \param data The overworld data used to create the event.
+             * \param event The event in json. Its `type` field gives the class of the event.
+             */
+            void addEvent(OverworldData &data, nlohmann::json const &event);
             /*!
              * \brief Returns all the events in the given position.
              * \param position The position in which to search for event.
+             * \warning The returned span is invalidated when an event enters or leaves the tile.
+             */
+            std::span<AbstractEvent *const> getEvent(sf::Vector2i position) const;
+            /*!
+             * \brief Moves the events which are no longer in the given tile to the tile where they are now.
+             * \details Must be called each time an event of the map changes tile, with its previous position.
+             * \param oldPosition The previous position of the event.
              */
-            std::list<AbstractEvent *> getEvent(sf::Vector2i position) const;
+            void updateEventTile(sf::Vector2i oldPosition);
             /*!
              * \brief Returns all the events of the map.
              */
@@ -156,18 +244,44 @@ namespace OpMon {
             void updateElements(sf::RenderTexture &frame);
 
             /*!
-             * \brief Returns the tile code at the given position and layer.
+             * \brief Returns the tile code (GID) at the given position and layer.
              * \param pos The position of the tile.
              * \param layer The layer of the tile.
+             * \returns The GID of the tile, 0 being the void.
              */
             int getCurrentTileCode(sf::Vector2i const &pos, int layer) const;
 
             /*!
-             * \brief Returns the collision associated with a tile.
-             * \param tile The tile code.
+             * \brief Returns the collision associated with a tile, read from its tileset.
+             * \param tile The tile code (GID).
              */
             int getTileCollision(int tile) const;
 
+            const std::vector<TilesetRange> &getTilesets() const {
+                return tilesets;
+            }
+
+            /*!
+             * \brief Returns the atlas containing the tiles of the map.
+             */
+            std::shared_ptr<const TileAtlas> getAtlas() const {
+                return atlas;
+            }
+
+            /*!
+             * \brief Sets the frames used by the map, given by OverworldData::loadMap.
+             */
+            void setTextures(std::map<std::string, std::shared_ptr<const Ui::Frames>> &&textures) {
+                this->textures = std::move(textures);
+            }
+            /*!
+             * \brief Returns the frames of the given key used by the map, or `nullptr` if the map doesn't use them.
+             */
+            const Ui::Frames *getTextures(std::string const &key) const {
+                auto itor = textures.find(key);
+                return itor == textures.end() ? nullptr : itor->second.get();
+            }
+
             /*!
              * \brief Returns the collision box of the given position.
              * \details The method searches in the two first layers at this position. If one blocks the player, it's prioritary.
@@ -175,12 +289,52 @@ namespace OpMon {
              */
             int getCollision(sf::Vector2i const &pos) const;
 
+            /*!
+             * \brief Returns the byte of the collision grid at the given position.
+             * \details Contains the PASS_* flags telling from which directions the tile can be entered, and the collision code (see COLLISION_CODE). Outside of the map, the tile can't be entered.
+             * \param pos The position of the tile.
+             */
+            std::uint8_t getCollisionFlags(sf::Vector2i const &pos) const {
+                if(pos.x < 0 || pos.x >= w || pos.y < 0 || pos.y >= h) {
+                    return 0;
+                }
+                return collisions[pos.x + pos.y * w];
+            }
+
+            /*!
+             * \brief Returns the whole collision grid, indexed by `x + y * w`.
+             */
+            std::span<const std::uint8_t> getCollisions() const {
+                return std::span<const std::uint8_t>(collisions, w * h);
+            }
+
             /*!
              * \brief Loads the map and returns it.
              * \warning This method doesn't load the map in this object! It returns a new Map object loaded with the data contained in the current Map object.
              * \returns A pointer to the loaded Map.
              */
-            Map *loadMap(OverworldData &data);
+            Map *loadMap(OverworldData &data) const;
+
+            /*!
+             * \brief Returns an unloaded copy of the map, which can be loaded again later.
+             * \details Like Map::loadMap, the current object isn't modified.
+             */
+            Map *unloadMap() const;
+
+            /*!
+             * \brief Returns an estimation of the memory used by the map, in bytes.
+             * \details The layers and the collisions read from a MapPack aren't counted, since they belong to the mapped file.
+             */
+            std::size_t getMemorySize() const;
+
+            /*!
+             * \brief Returns the persistent state of the events (see AbstractEvent::getPersistentState), by position in the events of the map.
+             */
+            std::map<std::size_t, nlohmann::json> getEventsState() const;
+            /*!
+             * \brief Restores a state returned by Map::getEventsState in the events of the reloaded map.
+             */
+            void setEventsState(std::map<std::size_t, nlohmann::json> const &states);
 
             /*!
              * \brief Returns a string containing information on the Map.
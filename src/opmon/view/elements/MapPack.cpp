@@ -0,0 +1,227 @@
+/*
+MapPack.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "MapPack.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <optional>
+
+#include "Map.hpp"
+#include "src/nlohmann/json.hpp"
+#include "src/utils/binaryfile.hpp"
+#include "src/utils/exceptions.hpp"
+#include "src/utils/log.hpp"
+
+#define MAP_PACK_MAGIC "OPMP"
+#define MAP_PACK_VERSION 2
+//Size of an entry of the index
+#define MAP_PACK_ENTRY_SIZE 16
+
+namespace {
+    //Reads the values of a record, checking that they don't go past its end
+    class RecordReader {
+      public:
+        RecordReader(const char *begin, const char *end, const std::string &path)
+          : current(begin)
+          , end(end)
+          , path(path) {}
+
+        const char *read(std::size_t size) {
+            if((std::size_t)(end - current) < size) {
+                throw Utils::LoadingException(path, true);
+            }
+            const char *data = current;
+            current += size;
+            return data;
+        }
+
+        template <typename T>
+        T readInt() {
+            T value;
+            std::memcpy(&value, read(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        std::string readString() {
+            std::uint16_t length = readInt<std::uint16_t>();
+            return std::string(read(length), length);
+        }
+
+        //Skips the padding up to the next multiple of alignment (relative to the start of the file, which is page aligned)
+        void align(const char *fileStart, std::size_t alignment) {
+            read((alignment - (current - fileStart) % alignment) % alignment);
+        }
+
+      private:
+        const char *current;
+        const char *end;
+        const std::string &path;
+    };
+
+    using Utils::BinaryFile::writeInt;
+
+    void writeString(std::string &buffer, const std::string &str) {
+        writeInt(buffer, str.size(), 2);
+        buffer += str;
+    }
+
+    void pad(std::string &buffer, std::size_t alignment) {
+        while(buffer.size() % alignment != 0) {
+            buffer.push_back('\0');
+        }
+    }
+} // namespace
+
+namespace OpMon {
+    namespace Elements {
+
+        bool MapPack::open(const std::string &path) {
+            this->path = path;
+            index.clear();
+            if(!file.open(path)) {
+                return false;
+            }
+
+            std::optional<std::uint32_t> count = Utils::BinaryFile::readHeader(file, path, MAP_PACK_MAGIC, MAP_PACK_VERSION, MAP_PACK_ENTRY_SIZE, "map pack");
+            if(!count) {
+                file.close();
+                return false;
+            }
+
+            index.resize(*count);
+            for(std::uint32_t i = 0; i < *count; i++) {
+                IndexEntry &entry = index[i];
+                std::memcpy(&entry, file.getData() + BINARY_FILE_HEADER_SIZE + i * MAP_PACK_ENTRY_SIZE, MAP_PACK_ENTRY_SIZE);
+                if(!Utils::BinaryFile::contains(file, entry.idOffset, entry.idLength) || !Utils::BinaryFile::contains(file, entry.recordOffset, entry.recordSize)
+                   || entry.recordOffset % 4 != 0) {
+                    Utils::Log::warn(path + " has an invalid index.");
+                    index.clear();
+                    file.close();
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::string MapPack::getId(std::size_t map) const {
+            return std::string(file.getData() + index[map].idOffset, index[map].idLength);
+        }
+
+        MapRecord MapPack::readMap(std::size_t map) const {
+            const char *start = file.getData() + index[map].recordOffset;
+            RecordReader reader(start, start + index[map].recordSize, path);
+            MapRecord record;
+
+            record.w = reader.readInt<std::uint16_t>();
+            record.h = reader.readInt<std::uint16_t>();
+            record.indoor = reader.readInt<std::uint8_t>() != 0;
+            std::uint8_t animationsCount = reader.readInt<std::uint8_t>();
+            record.music = reader.readString();
+            for(std::uint8_t i = 0; i < animationsCount; i++) {
+                record.animations.push_back(reader.readString());
+            }
+            std::uint8_t tilesetsCount = reader.readInt<std::uint8_t>();
+            for(std::uint8_t i = 0; i < tilesetsCount; i++) {
+                int firstGid = reader.readInt<std::uint16_t>();
+                record.tilesets.push_back({firstGid, &Tileset::get(reader.readString())});
+            }
+
+            std::size_t tilesCount = (std::size_t)record.w * record.h;
+            reader.align(file.getData(), 2);
+            for(const std::uint16_t *&layer : record.layers) {
+                layer = (const std::uint16_t *)reader.read(tilesCount * 2);
+            }
+            record.collisions = (const std::uint8_t *)reader.read(tilesCount);
+
+            std::uint32_t eventsCount = reader.readInt<std::uint32_t>();
+            record.events.reserve(eventsCount);
+            for(std::uint32_t i = 0; i < eventsCount; i++) {
+                std::uint32_t size = reader.readInt<std::uint32_t>();
+                record.events.emplace_back(reader.read(size), size);
+            }
+            return record;
+        }
+
+        void MapPack::compile(const std::string &jsonPath, const std::string &packPath) {
+            std::ifstream jsonFile(jsonPath);
+            if(!jsonFile) {
+                throw Utils::LoadingException(jsonPath, true);
+            }
+            nlohmann::json mapsJson;
+            jsonFile >> mapsJson;
+
+            std::string buffer;
+            Utils::BinaryFile::writeHeader(buffer, MAP_PACK_MAGIC, MAP_PACK_VERSION, mapsJson.size());
+            //The index is filled once the records are written
+            buffer.resize(BINARY_FILE_HEADER_SIZE + mapsJson.size() * MAP_PACK_ENTRY_SIZE);
+
+            std::size_t entry = BINARY_FILE_HEADER_SIZE;
+            for(const nlohmann::json &mapJson : mapsJson) {
+                std::string id = mapJson.at("id");
+                std::vector<std::string> animations = mapJson.value("animations", std::vector<std::string>());
+                std::vector<TilesetRange> tilesets = readTilesets(mapJson);
+                //The map is built to bake its collisions
+                Map map(mapJson.at("layers")[0], mapJson.at("layers")[1], mapJson.at("layers")[2],
+                        mapJson.at("size")[0], mapJson.at("size")[1], mapJson.at("indoor"), mapJson.at("music"), tilesets, animations);
+                if(map.getW() > 0xFFFF || map.getH() > 0xFFFF || animations.size() > 0xFF || tilesets.size() > 0xFF) {
+                    throw Utils::UnexpectedValueException(id, "a map smaller than 65536x65536 with less than 256 animated elements and tilesets", true);
+                }
+
+                std::uint32_t idOffset = buffer.size();
+                buffer += id;
+                pad(buffer, 4);
+                std::uint32_t recordOffset = buffer.size();
+
+                writeInt(buffer, map.getW(), 2);
+                writeInt(buffer, map.getH(), 2);
+                writeInt(buffer, map.isIndoor(), 1);
+                writeInt(buffer, animations.size(), 1);
+                writeString(buffer, map.getBg());
+                for(const std::string &animation : animations) {
+                    writeString(buffer, animation);
+                }
+                writeInt(buffer, tilesets.size(), 1);
+                for(const TilesetRange &tileset : tilesets) {
+                    writeInt(buffer, tileset.firstGid, 2);
+                    writeString(buffer, tileset.tileset->getPath());
+                }
+                pad(buffer, 2);
+                std::vector<std::uint16_t> layer3 = map.getLayer3().decompress();
+                for(const std::uint16_t *layer : {map.getLayer1(), map.getLayer2(), (const std::uint16_t *)layer3.data()}) {
+                    for(int i = 0; i < map.getW() * map.getH(); i++) {
+                        writeInt(buffer, layer[i], 2);
+                    }
+                }
+                for(std::uint8_t collision : map.getCollisions()) {
+                    writeInt(buffer, collision, 1);
+                }
+                writeInt(buffer, mapJson.at("events").size(), 4);
+                for(const nlohmann::json &event : mapJson.at("events")) {
+                    std::vector<std::uint8_t> msgpack = nlohmann::json::to_msgpack(event);
+                    writeInt(buffer, msgpack.size(), 4);
+                    buffer.append(msgpack.begin(), msgpack.end());
+                }
+
+                //Index entry : id offset, id length, record offset, record size
+                std::string indexEntry;
+                writeInt(indexEntry, idOffset, 4);
+                writeInt(indexEntry, id.size(), 4);
+                writeInt(indexEntry, recordOffset, 4);
+                writeInt(indexEntry, buffer.size() - recordOffset, 4);
+                buffer.replace(entry, MAP_PACK_ENTRY_SIZE, indexEntry);
+                entry += MAP_PACK_ENTRY_SIZE;
+                pad(buffer, 4);
+            }
+
+            std::ofstream packFile(packPath, std::ios::binary);
+            if(!packFile || !packFile.write(buffer.data(), buffer.size())) {
+                throw Utils::LoadingException(packPath, true);
+            }
+            Utils::Log::oplog("Compiled " + std::to_string(mapsJson.size()) + " maps in " + packPath);
+        }
+
+    } // namespace Elements
+} // namespace OpMon
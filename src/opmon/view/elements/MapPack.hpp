@@ -0,0 +1,105 @@
+/*!
+ * \file MapPack.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Tileset.hpp"
+#include "src/utils/MappedFile.hpp"
+
+namespace OpMon {
+    namespace Elements {
+
+        /*!
+         * \brief The content of a map stored in a MapPack.
+         * \details The layers, the collisions and the events point in the pack : they stay valid as long as the pack is open.
+         */
+        struct MapRecord {
+            int w;
+            int h;
+            bool indoor;
+            std::string music;
+            std::vector<std::string> animations;
+            std::vector<TilesetRange> tilesets;
+            /*!
+             * \brief The three tile layers, of `w * h` tiles each.
+             */
+            const std::uint16_t *layers[3];
+            /*!
+             * \brief The collision grid (see Map::getCollisionFlags).
+             */
+            const std::uint8_t *collisions;
+            /*!
+             * \brief The events of the map, each one encoded in MessagePack.
+             */
+            std::vector<std::span<const char>> events;
+        };
+
+        /*!
+         * \brief A compiled pack of maps, read from a memory mapped file.
+         * \details The pack is compiled from `data/maps.json` with MapPack::compile (see the `--compile-maps` option). Opening it only reads its index :
+         * the content of a map is read when the map is loaded, directly from the mapping.
+         *
+         * All the values are little-endian. The file contains :
+         * - A header (see Utils::BinaryFile) : the magic number `OPMP`, the version, the byte order mark and the number of maps.
+         * - The index : for each map, the offset and the length of its id, and the offset and the size of its record (4 bytes each).
+         * - The ids and the records. A record contains the size of the map (2 x 2 bytes), if it is indoor (1 byte), the number of animated elements (1 byte),
+         * the music and the animated elements (each one being a 2 bytes length and the characters), the number of tilesets (1 byte) and the tilesets
+         * (each one being its first GID on 2 bytes and its path, stored like the music), the three layers (2 bytes per tile, aligned on 2 bytes),
+         * the collision grid (1 byte per tile), then the number of events (4 bytes) and the events (each one being a 4 bytes size and the event in MessagePack).
+         */
+        class MapPack {
+          public:
+            /*!
+             * \brief Opens a pack and checks its index.
+             * \returns `false` if the file can't be opened or isn't a valid pack.
+             */
+            bool open(const std::string &path);
+
+            std::size_t getMapCount() const {
+                return index.size();
+            }
+
+            /*!
+             * \brief Returns the id of a map.
+             * \param map The position of the map in the pack.
+             */
+            std::string getId(std::size_t map) const;
+
+            /*!
+             * \brief Reads the record of a map.
+             * \param map The position of the map in the pack.
+             * \throws Utils::LoadingException If the record is invalid.
+             */
+            MapRecord readMap(std::size_t map) const;
+
+            /*!
+             * \brief Compiles the maps of a json file in a pack.
+             * \param jsonPath The path of the maps file (usually `data/maps.json`).
+             * \param packPath The path of the pack to write.
+             * \throws Utils::LoadingException If a file can't be read or written.
+             */
+            static void compile(const std::string &jsonPath, const std::string &packPath);
+
+          private:
+            struct IndexEntry {
+                std::uint32_t idOffset;
+                std::uint32_t idLength;
+                std::uint32_t recordOffset;
+                std::uint32_t recordSize;
+            };
+
+            std::string path;
+            Utils::MappedFile file;
+            std::vector<IndexEntry> index;
+        };
+
+    } // namespace Elements
+} // namespace OpMon
@@ -58,6 +58,7 @@ namespace OpMon {
                 anim = true;
 
                 if((!event && debugCol) /*Noclip mode in the debug*/ || checkPass(dir, map)) {
+                    sf::Vector2i oldPosition(posX, posY);
                     justTP = false;
                     movement = true;
                     switch(dir) {
@@ -79,6 +80,9 @@ namespace OpMon {
                     case Side::STAY:
                         break;
                     }
+                    if(event && map != nullptr) {
+                        map->updateEventTile(oldPosition);
+                    }
                     return true;
                 }
             }
@@ -96,49 +100,40 @@ namespace OpMon {
 
         bool Position::checkPass(Side direction, Map *map) {
 
-            std::list<AbstractEvent *> nextEvents;
             sf::Vector2i nextPos;
-            sf::Vector2i nextPosPix;
-            int exclusiveCol = 0;
+            std::uint8_t passFlag = 0;
 
             //Finds the next tile's position
             switch(direction) {
             case Side::TO_UP:
                 nextPos = sf::Vector2i(posX, posY - 1);
-                exclusiveCol = 8;
+                passFlag = PASS_UP;
                 break;
             case Side::TO_DOWN:
                 nextPos = sf::Vector2i(posX, posY + 1);
-                exclusiveCol = 7;
+                passFlag = PASS_DOWN;
                 break;
             case Side::TO_LEFT:
                 nextPos = sf::Vector2i(posX - 1, posY);
-                exclusiveCol = 6;
+                passFlag = PASS_LEFT;
                 break;
             case Side::TO_RIGHT:
                 nextPos = sf::Vector2i(posX + 1, posY);
-                exclusiveCol = 5;
+                passFlag = PASS_RIGHT;
                 break;
             default:
                 return true;
                 break;
             }
 
-            nextPosPix = nextPos SQUARES;
-
-            if(nextPos.x >= 0 && nextPos.x < map->getW() && nextPos.y >= 0 && nextPos.y < map->getH()) { //Avoid checking in the void (Out of the map's bounds)
-                int colLayer1 = map->getTileCollision(map->getCurrentTileCode(nextPos, 1));
-                int colLayer2 = map->getTileCollision(map->getCurrentTileCode(nextPos, 2));
-                if((colLayer1 == 0 || colLayer1 == exclusiveCol) && (colLayer2 == 0 || colLayer2 == exclusiveCol)) {           //Checks if the next tile is passable
-                    if(event ? !(nextPos.y == playerPos->getPosition().y && nextPos.x == playerPos->getPosition().x) : true) { //Checks if the player is not in the way, but only if it's an event (A player can not interact with itself.)
-                        nextEvents = map->getEvent(nextPos);                                                                   //Searches the events at this position
-                        for(AbstractEvent *nextEvent : nextEvents) {
-                            if(!nextEvent->isPassable()) { //Checks if the event ahead of the player is passable
-                                return false;
-                            }
+            if(map->getCollisionFlags(nextPos) & passFlag) {                                                              //Checks if the next tile is passable (Always false out of the map's bounds)
+                if(event ? !(nextPos.y == playerPos->getPosition().y && nextPos.x == playerPos->getPosition().x) : true) { //Checks if the player is not in the way, but only if it's an event (A player can not interact with itself.)
+                    for(AbstractEvent *nextEvent : map->getEvent(nextPos)) {                                               //Searches the events at this position
+                        if(!nextEvent->isPassable()) { //Checks if the event ahead of the player is passable
+                            return false;
                         }
-                        return true;
                     }
+                    return true;
                 }
             }
 
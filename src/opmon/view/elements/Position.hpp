@@ -73,7 +73,7 @@ namespace OpMon {
                 return dir;
             }
 
-            bool isAnim() {
+            bool isAnim() const {
                 return anim;
             }
 
@@ -122,6 +122,7 @@ namespace OpMon {
             /*!
              * \brief Moves the entity.
              * \details This method checks for the current collisions, checks if the entity can move, and then activates the animation and the movement.
+             * If the entity is an event, its new tile is updated in the map's events index (see Map::updateEventTile).
              * \param dir The direction of the movement
              * \param map The current map
              * \param debugCol If noclip is activated
@@ -0,0 +1,40 @@
+/*
+TileLayer.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "TileLayer.hpp"
+
+#include <algorithm>
+
+namespace OpMon {
+    namespace Elements {
+
+        TileLayer::TileLayer(std::span<const std::uint16_t> tiles)
+          : tilesCount(tiles.size()) {
+            blocks.resize((tiles.size() + TILE_BLOCK_SIZE - 1) / TILE_BLOCK_SIZE, emptyBlock);
+            for(std::size_t block = 0; block < blocks.size(); block++) {
+                std::span<const std::uint16_t> blockTiles = tiles.subspan(block * TILE_BLOCK_SIZE, std::min<std::size_t>(TILE_BLOCK_SIZE, tiles.size() - block * TILE_BLOCK_SIZE));
+                if(std::any_of(blockTiles.begin(), blockTiles.end(), [](std::uint16_t tile) { return tile != 0; })) {
+                    blocks[block] = data.size();
+                    data.insert(data.end(), blockTiles.begin(), blockTiles.end());
+                    //The last block is completed, so every stored block has TILE_BLOCK_SIZE tiles
+                    data.resize(blocks[block] + TILE_BLOCK_SIZE, 0);
+                }
+            }
+            data.shrink_to_fit();
+        }
+
+        std::vector<std::uint16_t> TileLayer::decompress() const {
+            std::vector<std::uint16_t> tiles(tilesCount, 0);
+            for(std::size_t block = 0; block < blocks.size(); block++) {
+                if(blocks[block] != emptyBlock) {
+                    std::size_t count = std::min<std::size_t>(TILE_BLOCK_SIZE, tilesCount - block * TILE_BLOCK_SIZE);
+                    std::copy_n(data.begin() + blocks[block], count, tiles.begin() + block * TILE_BLOCK_SIZE);
+                }
+            }
+            return tiles;
+        }
+
+    } // namespace Elements
+} // namespace OpMon
@@ -0,0 +1,75 @@
+/*!
+ * \file TileLayer.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/*!
+ * \brief The number of tiles of a block of a TileLayer.
+ */
+#define TILE_BLOCK_SIZE 16
+
+namespace OpMon {
+    namespace Elements {
+
+        /*!
+         * \brief A layer of tiles in which the void isn't stored.
+         * \details The tiles are split in blocks of #TILE_BLOCK_SIZE tiles. Only the blocks containing at least one tile are stored, so a
+         * layer which is mostly void (like the third layer of most maps) takes little memory. A tile is still read in constant time.
+         */
+        class TileLayer {
+          public:
+            TileLayer() = default;
+            /*!
+             * \brief Compresses a layer.
+             * \param tiles The tiles of the layer, 0 being the void.
+             */
+            explicit TileLayer(std::span<const std::uint16_t> tiles);
+
+            /*!
+             * \brief Returns a tile.
+             * \param tile The position of the tile in the layer (`x + y * w`).
+             */
+            std::uint16_t operator[](std::size_t tile) const {
+                std::uint32_t block = blocks[tile / TILE_BLOCK_SIZE];
+                return block == emptyBlock ? 0 : data[block + tile % TILE_BLOCK_SIZE];
+            }
+
+            std::size_t size() const {
+                return tilesCount;
+            }
+
+            /*!
+             * \brief Returns all the tiles of the layer, with the void.
+             */
+            std::vector<std::uint16_t> decompress() const;
+
+            /*!
+             * \brief Returns the memory used by the layer, in bytes.
+             */
+            std::size_t getMemorySize() const {
+                return blocks.size() * sizeof(std::uint32_t) + data.size() * sizeof(std::uint16_t);
+            }
+
+          private:
+            static constexpr std::uint32_t emptyBlock = 0xFFFFFFFF;
+
+            /*!
+             * \brief The position of each block in TileLayer::data, or `emptyBlock` if the block only contains void.
+             */
+            std::vector<std::uint32_t> blocks;
+            /*!
+             * \brief The tiles of the stored blocks.
+             */
+            std::vector<std::uint16_t> data;
+            std::size_t tilesCount = 0;
+        };
+
+    } // namespace Elements
+} // namespace OpMon
@@ -0,0 +1,229 @@
+/*
+Tileset.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "Tileset.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+
+#include "src/utils/ResourceLoader.hpp"
+#include "src/utils/exceptions.hpp"
+#include "src/utils/log.hpp"
+#include "src/utils/mainthread.hpp"
+
+#define FILL_VOID 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+
+namespace {
+    //The collisions of the default tileset, used if its file doesn't exist
+    const std::uint8_t legacyCollisions[4096] = {
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, FILL_VOID, //The last tile of this line allows to make invisible walls
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, FILL_VOID, //1
+        0, 0, 1, 1, 1, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, FILL_VOID,
+        2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 8, 8, 8, 0, 0, 0, FILL_VOID,
+        2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5, 7, 7, 7, 0, 0, 0, FILL_VOID,
+        2, 2, 2, 2, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 6, 5, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, FILL_VOID,
+        0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 6, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID, //16
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, FILL_VOID, //32
+        1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 1, 0, 1, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID, //48
+        1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, FILL_VOID //63
+        //0  1  2  3  4  5  6  7  8  9  10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 +35
+    };
+
+#undef FILL_VOID
+
+    std::mutex tilesetsMutex;
+    std::map<std::string, std::unique_ptr<OpMon::Elements::Tileset>> tilesets;
+} // namespace
+
+namespace OpMon {
+    namespace Elements {
+
+        const Tileset &Tileset::get(const std::string &path) {
+            std::lock_guard<std::mutex> lock(tilesetsMutex);
+            std::unique_ptr<Tileset> &tileset = tilesets[path];
+            if(!tileset) {
+                tileset.reset(new Tileset(path));
+            }
+            return *tileset;
+        }
+
+        Tileset::Tileset(const std::string &path)
+          : path(path) {
+            std::unique_ptr<std::istream> file = Utils::ResourceLoader::openFile(path);
+            if(!file) {
+                if(path == DEFAULT_TILESET) {
+                    imagePath = "tileset/tileset.png";
+                    collisions.assign(std::begin(legacyCollisions), std::end(legacyCollisions));
+                } else {
+                    Utils::Log::warn("Unable to open the tileset " + path);
+                }
+                return;
+            }
+
+            nlohmann::json tilesetJson;
+            *file >> tilesetJson;
+            if(tilesetJson.value("tilewidth", 32) != 32 || tilesetJson.value("tileheight", 32) != 32) {
+                throw Utils::UnexpectedValueException(path, "a tileset of 32x32 tiles", true);
+            }
+            //The image is relative to the tileset file
+            imagePath = (std::filesystem::path(path).parent_path() / tilesetJson.at("image").get<std::string>()).generic_string();
+            for(const nlohmann::json &tile : tilesetJson.value("tiles", nlohmann::json::array())) {
+                for(const nlohmann::json &property : tile.value("properties", nlohmann::json::array())) {
+                    if(property.at("name") == "collision") {
+                        std::size_t id = tile.at("id");
+                        if(id >= collisions.size()) {
+                            collisions.resize(id + 1, 0);
+                        }
+                        collisions[id] = property.at("value");
+                    }
+                }
+            }
+        }
+
+        const sf::Image &Tileset::getImage() const {
+            std::call_once(imageLoaded, [this]() {
+                if(!Utils::ResourceLoader::loadFile(image, imagePath)) {
+                    Utils::Log::warn("Unable to load the image of the tileset " + path);
+                }
+            });
+            return image;
+        }
+
+        std::vector<TilesetRange> readTilesets(const nlohmann::json &mapJson) {
+            std::vector<TilesetRange> ranges;
+            if(!mapJson.contains("tilesets")) {
+                ranges.push_back({1, &Tileset::get(DEFAULT_TILESET)});
+                return ranges;
+            }
+            for(const nlohmann::json &range : mapJson.at("tilesets")) {
+                ranges.push_back({range.at("firstgid"), &Tileset::get(range.at("source"))});
+            }
+            std::sort(ranges.begin(), ranges.end(), [](const TilesetRange &a, const TilesetRange &b) { return a.firstGid < b.firstGid; });
+            return ranges;
+        }
+
+        const TilesetRange *findTileset(std::span<const TilesetRange> tilesets, int gid) {
+            //The last tileset starting before the tile
+            auto itor = std::upper_bound(tilesets.begin(), tilesets.end(), gid, [](int gid, const TilesetRange &range) { return gid < range.firstGid; });
+            if(gid == 0 || itor == tilesets.begin()) {
+                return nullptr;
+            }
+            return &*(itor - 1);
+        }
+
+        TileAtlas::TileAtlas(std::span<const TilesetRange> tilesets, std::initializer_list<std::span<const std::uint16_t>> layers) {
+            //Gives a slot to each tile used
+            std::vector<std::uint16_t> used;
+            for(std::span<const std::uint16_t> layer : layers) {
+                for(std::uint16_t gid : layer) {
+                    if(gid == 0) {
+                        continue;
+                    }
+                    if(gid >= slots.size()) {
+                        slots.resize(gid + 1, -1);
+                    }
+                    if(slots[gid] == -1) {
+                        slots[gid] = used.size();
+                        used.push_back(gid);
+                    }
+                }
+            }
+            if(used.empty()) {
+                return;
+            }
+
+            columns = (int)std::ceil(std::sqrt((double)used.size()));
+            int rows = (used.size() + columns - 1) / columns;
+            sf::Image atlas;
+            atlas.create(columns * 32, rows * 32, sf::Color::Transparent);
+            for(std::size_t slot = 0; slot < used.size(); slot++) {
+                const TilesetRange *range = findTileset(tilesets, used[slot]);
+                if(range == nullptr) {
+                    continue;
+                }
+                const sf::Image &image = range->tileset->getImage();
+                int tile = used[slot] - range->firstGid;
+                int tilesetColumns = image.getSize().x / 32;
+                if(tilesetColumns == 0 || (unsigned int)(tile / tilesetColumns + 1) * 32 > image.getSize().y) {
+                    Utils::Log::warn("The tile " + std::to_string(tile) + " isn't in the tileset " + range->tileset->getPath());
+                    continue;
+                }
+                atlas.copy(image, (slot % columns) * 32, (slot / columns) * 32, sf::IntRect((tile % tilesetColumns) * 32, (tile / tilesetColumns) * 32, 32, 32));
+            }
+
+            Utils::MainThread::run([this, &atlas]() {
+                if(!texture.loadFromImage(atlas)) {
+                    Utils::Log::warn("Unable to create a tile atlas of " + std::to_string(atlas.getSize().x) + "x" + std::to_string(atlas.getSize().y) + " pixels.");
+                }
+            });
+        }
+
+        sf::Vector2i TileAtlas::getTilePosition(std::uint16_t gid) const {
+            if(gid >= slots.size() || slots[gid] == -1) {
+                return sf::Vector2i(-1, -1);
+            }
+            return sf::Vector2i((slots[gid] % columns) * 32, (slots[gid] / columns) * 32);
+        }
+
+    } // namespace Elements
+} // namespace OpMon
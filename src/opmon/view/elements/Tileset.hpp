@@ -0,0 +1,123 @@
+/*!
+ * \file Tileset.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "src/nlohmann/json.hpp"
+
+//The tileset used by the maps which don't give their tilesets
+#define DEFAULT_TILESET "tileset/tileset.json"
+
+namespace OpMon {
+    namespace Elements {
+
+        /*!
+         * \brief A tileset : an image containing tiles of 32x32 pixels, and the collision code of each tile.
+         * \details A tileset is described by a tileset file in the json format of the Tiled map editor (`.json`, with the image next to it).
+         * The collision code of a tile is read from its `collision` property, the tiles without this property being free.
+         * The tilesets are loaded once, when a map using them is loaded for the first time, and are kept until the end of the game.
+         */
+        class Tileset {
+          public:
+            /*!
+             * \brief Returns a tileset, loading its description if needed. Can be called from any thread.
+             * \param path The path of the tileset file, relative to the resource folder.
+             */
+            static const Tileset &get(const std::string &path);
+
+            /*!
+             * \brief Returns the collision code of a tile (see Map::getCollision).
+             * \param tile The position of the tile in the tileset, starting at 0.
+             */
+            std::uint8_t getCollision(int tile) const {
+                return (tile >= 0 && (std::size_t)tile < collisions.size()) ? collisions[tile] : 0;
+            }
+
+            /*!
+             * \brief Returns the image of the tileset, reading it the first time. Can be called from any thread.
+             */
+            const sf::Image &getImage() const;
+
+            const std::string &getPath() const {
+                return path;
+            }
+
+          private:
+            explicit Tileset(const std::string &path);
+
+            std::string path;
+            std::string imagePath;
+            std::vector<std::uint8_t> collisions;
+
+            mutable sf::Image image;
+            mutable std::once_flag imageLoaded;
+        };
+
+        /*!
+         * \brief A tileset used by a map, with the first tile id (GID) given to its tiles in the layers of the map.
+         * \details Like in Tiled, the tiles of a map's layers are numbered from 1, one tileset after another. 0 is the void.
+         */
+        struct TilesetRange {
+            int firstGid;
+            const Tileset *tileset;
+        };
+
+        /*!
+         * \brief Reads the tilesets of a map from its json, in the format used by Tiled : an array `tilesets` of `{"firstgid": ..., "source": ...}`.
+         * \details If the map doesn't give its tilesets, the map uses only the DEFAULT_TILESET.
+         */
+        std::vector<TilesetRange> readTilesets(const nlohmann::json &mapJson);
+
+        /*!
+         * \brief Finds the tileset containing a tile.
+         * \param tilesets The tilesets of a map, sorted by first GID.
+         * \param gid The tile id, as stored in the map's layers.
+         * \returns The tileset containing the tile, or `nullptr` if the tile is the void or if no tileset contains it.
+         */
+        const TilesetRange *findTileset(std::span<const TilesetRange> tilesets, int gid);
+
+        /*!
+         * \brief A texture containing only the tiles used by a map, copied from its tilesets.
+         * \details Since all the tiles of a map are in one texture, each layer of the map is drawn with a single texture, whatever the number of tilesets.
+         */
+        class TileAtlas {
+          public:
+            /*!
+             * \brief Builds the atlas. Can be called from any thread : the texture is uploaded by the main thread (see Utils::MainThread).
+             * \param tilesets The tilesets of the map, sorted by first GID.
+             * \param layers The layers of the map.
+             */
+            TileAtlas(std::span<const TilesetRange> tilesets, std::initializer_list<std::span<const std::uint16_t>> layers);
+
+            const sf::Texture &getTexture() const {
+                return texture;
+            }
+
+            /*!
+             * \brief Returns the position of a tile in the texture, in pixels.
+             * \returns The position, or (-1, -1) if the tile isn't in the atlas (like the void).
+             */
+            sf::Vector2i getTilePosition(std::uint16_t gid) const;
+
+          private:
+            sf::Texture texture;
+            /*!
+             * \brief The position of each tile in the atlas, by GID. -1 if the tile isn't in the atlas.
+             */
+            std::vector<int> slots;
+            int columns = 1;
+        };
+
+    } // namespace Elements
+} // namespace OpMon
@@ -5,32 +5,45 @@
 
 namespace OpMon {
 	namespace Elements {
-		AbstractEvent::AbstractEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger, sf::Vector2f const &position, int sides, bool passable)
-		: otherTextures(otherTextures)
+		AbstractEvent::AbstractEvent(const Ui::Frames &frames, EventTrigger eventTrigger, sf::Vector2f const &position, int sides, bool passable)
+		: frames(frames)
 		, eventTrigger(eventTrigger)
 		, position(32.0f * position)
 		, mapPos(position, true)
 		, passable(passable)
 		, sides(sides)
-		, sprite(new sf::Sprite())
-		, currentTexture(otherTextures.begin()) {
+		, sprite(new sf::Sprite()) {
 
 		}
 
 		AbstractEvent::AbstractEvent(OverworldData &data, nlohmann::json jsonData)
-		: otherTextures(data.getEventsTexture(jsonData.at("textures")))
+		: frames(data.getEventsTexture(jsonData.at("textures")))
 		, eventTrigger(jsonData.value("trigger", EventTrigger::PRESS))
 		, position(32.0f * sf::Vector2f(jsonData.value("position", std::vector<int>{0,0})[0], jsonData.value("position", std::vector<int>{0,0})[1]))
 		, mapPos((1.0f / 32.0f) * position, true)
 		, passable(jsonData.value("passable", true))
 		, sides(jsonData.value("side", SIDE_ALL))
-		, sprite(new sf::Sprite())
-		, currentTexture(otherTextures.begin()) {
+		, sprite(new sf::Sprite()) {
 		}
 
 		void AbstractEvent::updateTexture() {
 			this->sprite->setPosition(position);
-			this->sprite->setTexture(*currentTexture);
+			if(frames.texture != nullptr) {
+				this->sprite->setTexture(*frames.texture);
+				this->sprite->setTextureRect(frames.rects[currentFrame]);
+			}
+		}
+
+		void AbstractEvent::saveTickPosition(bool snap) {
+			tickPositions[0] = tickPositions[1];
+			tickPositions[1] = getSprite()->getPosition();
+			if(snap) {
+				tickPositions[0] = tickPositions[1];
+			}
+		}
+
+		sf::Vector2f AbstractEvent::getInterpolatedPosition(float interpolation) const {
+			return tickPositions[0] + (tickPositions[1] - tickPositions[0]) * interpolation;
 		}
 	}
 }
@@ -11,6 +11,7 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include "src/opmon/core/Player.hpp"
 #include "src/nlohmann/json.hpp"
+#include "src/opmon/view/ui/TextureAtlas.hpp"
 
 
 //Macros defining constants to know the side from where the events can be triggered.
@@ -51,7 +52,7 @@ namespace OpMon{
 		 * To create events that use other events, see AbstractMetaEvent.
 		 */
 		class AbstractEvent {
-			friend class TalkingCharaEvent; //Needed to update currentTexture without creating a public setter.
+			friend class TalkingCharaEvent; //Needed to update currentFrame without creating a public setter.
 		protected:
 			/*!
 			 * \brief How the event is triggered by the player.
@@ -80,19 +81,24 @@ namespace OpMon{
 			 */
 			Position mapPos;
 			/*!
-			 * \brief Other textures used by the event.
+			 * \brief The frames used by the event.
 			 */
-			std::vector<sf::Texture> &otherTextures;
+			const Ui::Frames &frames;
 			/*!
-			 * \brief An iterator to the current texture in \ref otherTextures.
+			 * \brief The index of the current frame in \ref frames.
 			 */
-			std::vector<sf::Texture>::iterator currentTexture;
+			std::size_t currentFrame = 0;
+			/*!
+			 * \brief The positions of the sprite at the end of the last two ticks.
+			 * \details Used to smooth the movements when a frame is drawn between two ticks.
+			 */
+			sf::Vector2f tickPositions[2];
 
 		public:
 			/*!
 			 * \warning The parameter position represents the position in squares, unlike the field position which stores the position in pixels.
 			 */
-			AbstractEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger, sf::Vector2f const &position, int sides, bool passable);
+			AbstractEvent(const Ui::Frames &frames, EventTrigger eventTrigger, sf::Vector2f const &position, int sides, bool passable);
 			AbstractEvent(OverworldData &data, nlohmann::json jsonData);
 			virtual ~AbstractEvent() = default;
 			/*!
@@ -104,15 +110,15 @@ namespace OpMon{
 			 */
 			virtual void action(Player &player, Overworld &overworld) = 0;
 			/*!
-			 * \brief Updates \ref sprite with \ref currentTexture and \ref position.
+			 * \brief Updates \ref sprite with \ref currentFrame and \ref position.
 			 */
 			virtual void updateTexture();
 
 			int getSide() const {
 				return sides;
 			}
-			virtual const sf::Texture &getTexture() {
-				return *currentTexture;
+			virtual std::size_t getCurrentFrame() const {
+				return currentFrame;
 			}
 			EventTrigger getEventTrigger() const {
 				return eventTrigger;
@@ -135,16 +141,49 @@ namespace OpMon{
 			}
 
 			/*!
-			 * \brief Sets the current texture to the first texture of \ref otherTextures.
+			 * \brief Saves the position of the sprite at the end of a tick.
+			 * \param snap If `true`, the previous position is forgotten and the sprite won't be interpolated from it (after a teleportation, for example).
+			 */
+			void saveTickPosition(bool snap = false);
+
+			/*!
+			 * \brief Returns the position where the sprite must be drawn between the last two ticks.
+			 * \param interpolation The time elapsed since the last tick, as a fraction of a tick.
 			 */
-			void resetTexture() {currentTexture = otherTextures.begin();}
+			sf::Vector2f getInterpolatedPosition(float interpolation) const;
+
+			/*!
+			 * \brief Sets the current frame to the first frame of \ref frames.
+			 */
+			void resetTexture() {currentFrame = 0;}
 
 			/*!
 			 * \brief If the activation of the event is over, returns true. If the event is still doing something, returns false.
 			 */
 			 virtual bool isOver() const = 0;
 
-			std::vector<sf::Texture>& getTextures() {return otherTextures;}
+			/*!
+			 * \brief Returns `true` if the event is in the middle of something which must not be slowed down, even far from the player (see Overworld::scheduleEvents).
+			 * \details By default, the event is busy until its activation is over.
+			 */
+			virtual bool isBusy() const {return !isOver();}
+
+			/*!
+			 * \brief Returns the state of the event which must be kept when its map is unloaded (see OverworldData::trimMaps), or `null` if there is none.
+			 */
+			virtual nlohmann::json getPersistentState() const {return nullptr;}
+			/*!
+			 * \brief Restores a state returned by getPersistentState, once the map of the event has been loaded again.
+			 */
+			virtual void setPersistentState(nlohmann::json const &/*state*/) {}
+
+			/*!
+			 * \brief Returns the id of the map where the event teleports the player, or an empty string if it doesn't.
+			 * \details Used to load the destination before the player gets there (see Overworld::prefetchMaps).
+			 */
+			virtual std::string getTeleportDestination() const {return "";}
+
+			const Ui::Frames &getFrames() const {return frames;}
 		};
 	}
 }
@@ -4,6 +4,8 @@
 #include "DialogEvent.hpp"
 #include "SoundEvent.hpp"
 #include "metaevents.hpp"
+#include "src/opmon/screens/overworld/Overworld.hpp"
+#include "src/opmon/view/elements/Map.hpp"
 
 namespace OpMon::Elements {
 	AbstractMetaEvent::AbstractMetaEvent(std::queue<AbstractEvent*> eventQueue)
@@ -37,7 +39,20 @@ namespace OpMon::Elements {
 	}
 
 	void AbstractMetaEvent::update(Player &player, Overworld &overworld){
+		sf::Vector2i oldPosition = mapPos.getPosition();
 		position = mainEvent->getPosition();
 		mapPos = mainEvent->getPositionMap();
+		if(mapPos.getPosition() != oldPosition){ //The main event is not in the map, so the map's events index must be updated here
+			overworld.getData().getCurrentMap()->updateEventTile(oldPosition);
+		}
+	}
+
+	std::string AbstractMetaEvent::getTeleportDestination() const {
+		for(std::queue<AbstractEvent*> events = eventQueue; !events.empty(); events.pop()){
+			if(events.front() != nullptr && !events.front()->getTeleportDestination().empty()){
+				return events.front()->getTeleportDestination();
+			}
+		}
+		return "";
 	}
 }
@@ -56,6 +56,10 @@ namespace OpMon{
             virtual void action(Player &player, Overworld &overworld) = 0;
             virtual void update(Player &player, Overworld &overworld);
             virtual bool isOver() const {return !processing;}
+            /*!
+             * \brief Busy while the queue is processed, or while \ref mainEvent is busy.
+             */
+            virtual bool isBusy() const {return processing || mainEvent->isBusy();}
             virtual ~AbstractMetaEvent();
             /*!
              * \brief Returns the sprite of \ref mainEvent.
@@ -64,11 +68,15 @@ namespace OpMon{
             /*!
              * \brief Returns the texture of \ref mainEvent.
              */
-            virtual const sf::Texture &getTexture() {return mainEvent->getTexture();}
+            virtual std::size_t getCurrentFrame() const {return mainEvent->getCurrentFrame();}
             /*!
              * \brief Updates the texture of \ref mainEvent.
              */
             virtual void updateTexture() {mainEvent->updateTexture();}
+            /*!
+             * \brief Returns the destination of the first event of the queue teleporting the player.
+             */
+            virtual std::string getTeleportDestination() const;
         };
     }
 }
@@ -4,8 +4,8 @@
 namespace OpMon {
 	namespace Elements {
 
-		AnimationEvent::AnimationEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger, sf::Vector2f const &position, unsigned int framerate, bool loop, bool passable, bool lastTexture, int sides)
-		: AbstractEvent(otherTextures, eventTrigger, position, sides, passable)
+		AnimationEvent::AnimationEvent(const Ui::Frames &frames, EventTrigger eventTrigger, sf::Vector2f const &position, unsigned int framerate, bool loop, bool passable, bool lastTexture, int sides)
+		: AbstractEvent(frames, eventTrigger, position, sides, passable)
 		, framerate(framerate)
 		, loop(loop)
 		, lastTexture(lastTexture) {
@@ -26,12 +26,12 @@ namespace OpMon {
 
 		void AnimationEvent::update(Player &player, Overworld &overworld){
 			if(playing && (framecount >= framerate)){
-				++currentTexture;
+				++currentFrame;
 				framecount = 0;
-				if(currentTexture == otherTextures.end()){
-					currentTexture = otherTextures.begin();
+				if(currentFrame >= frames.size()){
+					currentFrame = 0;
 					playing = loop; //If loop, continue playing, else, stop.
-					if(!playing && lastTexture) currentTexture = otherTextures.end() - 1;
+					if(!playing && lastTexture) currentFrame = frames.size() - 1;
 				}
 			}else if(playing && (framecount < framerate)){
 				framecount++;
@@ -43,10 +43,14 @@ namespace OpMon::Elements {
 		 */
 		bool lastTexture;
 	public:
-		AnimationEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger, sf::Vector2f const &position, unsigned int framerate, bool loop, bool passable, bool lastTexture = true, int sides = SIDE_ALL);
+		AnimationEvent(const Ui::Frames &frames, EventTrigger eventTrigger, sf::Vector2f const &position, unsigned int framerate, bool loop, bool passable, bool lastTexture = true, int sides = SIDE_ALL);
 		AnimationEvent(OverworldData &data, nlohmann::json jsonData);
 		void action(Player &player, Overworld &overworld);
 		void update(Player &player, Overworld &overworld);
 		bool isOver() const {return !playing;}
+		/*!
+		 * \brief Only the animations played once are busy : a looping animation can be slowed down when the player doesn't see it.
+		 */
+		bool isBusy() const {return playing && !loop;}
 	};
 }
@@ -4,8 +4,8 @@
 namespace OpMon {
 	namespace Elements {
 
-		BattleEvent::BattleEvent(std::vector<sf::Texture> &textures, sf::Vector2f const &position, OpTeam *team, EventTrigger eventTrigger, bool passable, int side)
-		: AbstractEvent(textures, eventTrigger, position, side, passable)
+		BattleEvent::BattleEvent(const Ui::Frames &frames, sf::Vector2f const &position, OpTeam *team, EventTrigger eventTrigger, bool passable, int side)
+		: AbstractEvent(frames, eventTrigger, position, side, passable)
 		, team(team){
 		}
 
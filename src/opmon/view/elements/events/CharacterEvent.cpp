@@ -5,10 +5,10 @@
 namespace OpMon {
 	namespace Elements {
 
-		CharacterEvent::CharacterEvent(std::vector<sf::Texture> &textures, sf::Vector2f const &position, Side posDir, MoveStyle moveStyle,
+		CharacterEvent::CharacterEvent(const Ui::Frames &frames, sf::Vector2f const &position, Side posDir, MoveStyle moveStyle,
 				EventTrigger eventTrigger, std::vector<Side> predefinedPath, bool passable,
 				int sides)
-		: AbstractEvent(textures, eventTrigger, position, sides, passable)
+		: AbstractEvent(frames, eventTrigger, position, sides, passable)
 		, moveStyle(moveStyle) {
 			sprite->setScale(2, 2);
 			sprite->setOrigin(16, 16);
@@ -96,18 +96,18 @@ namespace OpMon {
 			}
 			//Changes the texture to print, handles the movement itself.
 			if(mapPos.isAnim() && !anims && mapPos.getDir() != Side::STAY) { //First part of the animation
-				currentTexture = otherTextures.begin() + ((int)mapPos.getDir() + 4);
+				currentFrame = (int)mapPos.getDir() + 4;
 				animsCounter++;
 				anims = animsCounter > 8;
 			} else if(mapPos.isAnim() && anims && mapPos.getDir() != Side::STAY) { //Second part of the animation
-				currentTexture = otherTextures.begin() + ((int)mapPos.getDir() + 8);
+				currentFrame = (int)mapPos.getDir() + 8;
 				animsCounter++;
 				if(animsCounter > 16) {
 					anims = false;
 					animsCounter = 0;
 				}
 			} else if(!mapPos.isAnim()) { //The NPC is resting. With all these movements, maybe it's tired.
-				currentTexture = otherTextures.begin() + (int)mapPos.getDir();
+				currentFrame = (int)mapPos.getDir();
 			}
 
 			//This part moves the sprite's position
@@ -155,7 +155,7 @@ namespace OpMon {
 					break;
 				}
 				//Put the correct texture to the NPC
-				currentTexture = getTextures().begin() + (int)mapPos.getDir();
+				currentFrame = (int)mapPos.getDir();
 				updateTexture();
 				wantmove = false;
 			}
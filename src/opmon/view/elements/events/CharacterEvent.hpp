@@ -66,7 +66,7 @@ namespace OpMon::Elements {
 		bool wantmove = false;
 
 	public:
-		CharacterEvent(std::vector<sf::Texture> &textures, sf::Vector2f const &position, Side posDir = Side::TO_UP, MoveStyle moveStyle = MoveStyle::NO_MOVE, EventTrigger eventTrigger = EventTrigger::PRESS, std::vector<Side> predefinedPath = std::vector<Side>(), bool passable = false, int sides = SIDE_ALL);
+		CharacterEvent(const Ui::Frames &frames, sf::Vector2f const &position, Side posDir = Side::TO_UP, MoveStyle moveStyle = MoveStyle::NO_MOVE, EventTrigger eventTrigger = EventTrigger::PRESS, std::vector<Side> predefinedPath = std::vector<Side>(), bool passable = false, int sides = SIDE_ALL);
 		CharacterEvent(OverworldData &data, nlohmann::json jsonData);
 		virtual void update(Player &player, Overworld &overworld);
 		virtual void action(Player &, Overworld &){wantmove = true;}
@@ -85,5 +85,9 @@ namespace OpMon::Elements {
 		bool move(Side direction, Map *map);
 
 		bool isOver() const {return !wantmove;}
+		/*!
+		 * \brief A character is also busy while walking, so it never stops between two tiles.
+		 */
+		bool isBusy() const {return wantmove || mapPos.isAnim();}
 	};
 }
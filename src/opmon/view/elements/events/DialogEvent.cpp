@@ -4,8 +4,8 @@
 namespace OpMon {
 	namespace Elements {
 
-		DialogEvent::DialogEvent(std::vector<sf::Texture> &otherTextures, sf::Vector2f const &position, Utils::OpString const &dialogKey, int sides, EventTrigger eventTrigger, bool passable)
-		: AbstractEvent(otherTextures, eventTrigger, position, sides, passable)
+		DialogEvent::DialogEvent(const Ui::Frames &frames, sf::Vector2f const &position, Utils::OpString const &dialogKey, int sides, EventTrigger eventTrigger, bool passable)
+		: AbstractEvent(frames, eventTrigger, position, sides, passable)
 		, Utils::I18n::ATranslatable()
 		, dialogKey(dialogKey) {
 			this->onLangChanged();
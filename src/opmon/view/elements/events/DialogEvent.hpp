@@ -32,7 +32,7 @@ namespace OpMon{
 			bool over = true;
 
 		public:
-			DialogEvent(std::vector<sf::Texture> &otherTextures, sf::Vector2f const &position, Utils::OpString const &dialogKey, int sides = SIDE_ALL, EventTrigger eventTrigger = EventTrigger::PRESS, bool passable = false);
+			DialogEvent(const Ui::Frames &frames, sf::Vector2f const &position, Utils::OpString const &dialogKey, int sides = SIDE_ALL, EventTrigger eventTrigger = EventTrigger::PRESS, bool passable = false);
 			DialogEvent(OverworldData &data, nlohmann::json jsonData);
 			void onLangChanged() override;
 			virtual void update(Player &player, Overworld &overworld);
@@ -4,8 +4,8 @@
 namespace OpMon {
 	namespace Elements {
 
-		SoundEvent::SoundEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger, sf::Vector2f const &position, std::string const& playID, bool music, bool toggle, int sides, bool passable)
-				: AbstractEvent(otherTextures, eventTrigger, position, sides, passable)
+		SoundEvent::SoundEvent(const Ui::Frames &frames, EventTrigger eventTrigger, sf::Vector2f const &position, std::string const& playID, bool music, bool toggle, int sides, bool passable)
+				: AbstractEvent(frames, eventTrigger, position, sides, passable)
 				  , playID(playID)
 				  , music(music)
 				  , toggle(toggle) {}
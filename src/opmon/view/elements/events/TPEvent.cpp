@@ -4,10 +4,10 @@
 namespace OpMon {
 	namespace Elements {
 
-		TPEvent::TPEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger,
+		TPEvent::TPEvent(const Ui::Frames &frames, EventTrigger eventTrigger,
 				sf::Vector2f const &position, sf::Vector2i const &tpPos, std::string const &map, Side ppDir,
 				int sides, bool passable)
-		: AbstractEvent(otherTextures, eventTrigger, position, sides, passable)
+		: AbstractEvent(frames, eventTrigger, position, sides, passable)
 		, tpCoord(tpPos)
 		, map(map)
 		, ppDir(ppDir) {
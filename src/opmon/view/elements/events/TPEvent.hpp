@@ -36,11 +36,12 @@ namespace OpMon {
 			bool command = false;
 
 		public:
-			TPEvent(std::vector<sf::Texture> &otherTextures, EventTrigger eventTrigger, sf::Vector2f const &position, sf::Vector2i const &tpCoord, std::string const &map, Side ppDir = Side::NO_MOVE, int sides = SIDE_ALL, bool passable = true);
+			TPEvent(const Ui::Frames &frames, EventTrigger eventTrigger, sf::Vector2f const &position, sf::Vector2i const &tpCoord, std::string const &map, Side ppDir = Side::NO_MOVE, int sides = SIDE_ALL, bool passable = true);
 			TPEvent(OverworldData& data, nlohmann::json jsonData);
 			virtual void update(Player &player, Overworld &overworld);
 			virtual void action(Player &player, Overworld &overworld);
 			bool isOver() const {return !command;}
+			std::string getTeleportDestination() const {return map;}
 		};
 	}
 }
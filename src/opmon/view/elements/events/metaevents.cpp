@@ -37,10 +37,10 @@ namespace OpMon::Elements {
 	}
 
 
-	TalkingCharaEvent::TalkingCharaEvent(std::vector<sf::Texture> &textures, sf::Vector2f const &position, Utils::OpString const &dialogKey, Side posDir, EventTrigger eventTrigger, MoveStyle moveStyle, std::vector<Side> predefinedPath, bool passable, int side)
+	TalkingCharaEvent::TalkingCharaEvent(const Ui::Frames &frames, sf::Vector2f const &position, Utils::OpString const &dialogKey, Side posDir, EventTrigger eventTrigger, MoveStyle moveStyle, std::vector<Side> predefinedPath, bool passable, int side)
 	: LinearMetaEvent(std::queue<AbstractEvent*>(std::deque<AbstractEvent*>({
-		new CharacterEvent(textures, position, posDir, moveStyle, eventTrigger, predefinedPath, passable, sides),
-				new DialogEvent(textures, position, dialogKey, sides, eventTrigger, passable),
+		new CharacterEvent(frames, position, posDir, moveStyle, eventTrigger, predefinedPath, passable, sides),
+				new DialogEvent(frames, position, dialogKey, sides, eventTrigger, passable),
 				nullptr})),
 			std::queue<bool>(std::deque<bool>({false, false, false}))) {}
 
@@ -95,6 +95,23 @@ namespace OpMon::Elements {
 		AbstractMetaEvent::update(player, overworld);
 	}
 
+	nlohmann::json TrainerEvent::getPersistentState() const{
+		return defeated ? nlohmann::json{{"defeated", true}} : nlohmann::json();
+	}
+
+	void TrainerEvent::setPersistentState(nlohmann::json const &state){
+		if(!defeated && state.value("defeated", false)){
+			//Only keeps the post-battle NPC, like at the end of the battle
+			while(eventQueue.size() > 1){
+				delete(eventQueue.front());
+				eventQueue.pop();
+			}
+			mainEvent = eventQueue.front();
+			defeated = true;
+			triggered = false;
+		}
+	}
+
 	void TrainerEvent::action(Player &player, Overworld &overworld){
 		eventQueue.front()->action(player, overworld); //Triggers the first event in the queue.
 		triggered = true;
@@ -29,7 +29,7 @@ namespace OpMon::Elements {
 	 */
 	class TalkingCharaEvent: public LinearMetaEvent {
 	public:
-		TalkingCharaEvent(std::vector<sf::Texture> &textures, sf::Vector2f const &position, Utils::OpString const &dialogKey, Side posDir = Side::TO_UP, EventTrigger eventTrigger = EventTrigger::PRESS, MoveStyle moveStyle = MoveStyle::NO_MOVE, std::vector<Side> predefinedPath = std::vector<Side>(), bool passable = false, int side = SIDE_ALL);
+		TalkingCharaEvent(const Ui::Frames &frames, sf::Vector2f const &position, Utils::OpString const &dialogKey, Side posDir = Side::TO_UP, EventTrigger eventTrigger = EventTrigger::PRESS, MoveStyle moveStyle = MoveStyle::NO_MOVE, std::vector<Side> predefinedPath = std::vector<Side>(), bool passable = false, int side = SIDE_ALL);
 		TalkingCharaEvent(OverworldData &data, nlohmann::json jsonData);
 		void action(Player &player, Overworld &overworld);
 		void update(Player &player, Overworld &overworld);
@@ -64,5 +64,14 @@ namespace OpMon::Elements {
 		void action(Player &player, Overworld &overworld);
 		void update(Player &player, Overworld &overworld);
 		bool isDefeated() {return defeated;}
+		/*!
+		 * \brief The trainer is busy from the first dialog to the end of the battle.
+		 */
+		bool isBusy() const {return (triggered && !defeated) || AbstractMetaEvent::isBusy();}
+		/*!
+		 * \brief Keeps the trainer defeated when its map is unloaded.
+		 */
+		nlohmann::json getPersistentState() const;
+		void setPersistentState(nlohmann::json const &state);
 	};
 }
@@ -15,6 +15,7 @@ namespace OpMon {
     namespace Ui {
 
         void Dialog::init() {
+            dialogPass = uidata->getJukebox().getSound("dialog pass");
 
             unsigned int DIALOG_BOX_WIDTH = 504;
             unsigned int DIALOG_BOX_HEIGHT = 100;
@@ -72,7 +73,7 @@ namespace OpMon {
             } else if(text.size() > 0) {
                 // If the current lines are completely displayed, pass to the next set of lines when
                 // pressing space (if there is one)
-                uidata->getJukebox().playSound("dialog pass");
+                uidata->getJukebox().playSound(dialogPass);
                 line = 0;
                 i = 0;
                 currentTxt[0] = sf::String(" ");
@@ -61,7 +61,7 @@ class UiData;
             /*!
              * \brief The sound played when a dialog is passed.
              */
-            sf::Sound dialogPass;
+            SoundId dialogPass;
 
             UiData *uidata;
 
@@ -13,9 +13,13 @@ File under GNU GPL v3.0 license
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Transform.hpp>
 #include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <algorithm>
 #include <cmath>
 
-#include "src/utils/ResourceLoader.hpp"
+#include "src/opmon/view/elements/TileLayer.hpp"
+#include "src/opmon/view/elements/Tileset.hpp"
+#include "src/utils/mainthread.hpp"
 
 /* Converts degrees to radians */
 #define DEG *(3.14159265 / 180)
@@ -23,51 +27,83 @@ File under GNU GPL v3.0 license
 namespace OpMon {
     namespace Ui {
 
-        sf::Texture MapLayer::tileset;
-
-        MapLayer::MapLayer(sf::Vector2i size, const int tilesCodes[]) {
-            if(tileset.getSize() == sf::Vector2u(0, 0)) {
-                Utils::ResourceLoader::load(tileset, "tileset/tileset.png");
-            }
-            tiles.setPrimitiveType(sf::Quads);
-            tiles.resize(size.x * size.y * 4);
+        MapLayer::MapLayer(sf::Vector2i size, const std::uint16_t tilesCodes[], std::shared_ptr<const Elements::TileAtlas> atlas)
+          : atlas(std::move(atlas))
+          , chunksCount((size.x + MAP_CHUNK_SIZE - 1) / MAP_CHUNK_SIZE, (size.y + MAP_CHUNK_SIZE - 1) / MAP_CHUNK_SIZE) {
+            chunks.resize(chunksCount.x * chunksCount.y);
 
             for(int i = 0; i < size.y; i++) {
                 for(int j = 0; j < size.x; j++) {
-
-                    //The software we use (Tiled map editor) starts the first tile at 1, and leaves 0 for void. This line substracts one to every square.
-
-                    int tileNumber = tilesCodes[(i * size.x) + j] - 1;
-
-                    //Now that every void (0) became -1, this replaces every -1 by the "official" void tile.
-                    if(tileNumber == -1) {
-                        tileNumber = 257; //official void tile
+                    //The void (0) and the tiles missing from the atlas aren't drawn
+                    sf::Vector2i texturePosition = this->atlas->getTilePosition(tilesCodes[(i * size.x) + j]);
+                    if(texturePosition.x < 0) {
+                        continue;
                     }
+                    int tx = texturePosition.x / 32;
+                    int ty = texturePosition.y / 32;
+
+                    sf::VertexArray &tiles = chunks[(i / MAP_CHUNK_SIZE) * chunksCount.x + (j / MAP_CHUNK_SIZE)].tiles;
+                    tiles.append(sf::Vertex(sf::Vector2f(j * 32, i * 32), sf::Vector2f(tx * 32, ty * 32)));
+                    tiles.append(sf::Vertex(sf::Vector2f((j + 1) * 32, i * 32), sf::Vector2f((tx + 1) * 32, ty * 32)));
+                    tiles.append(sf::Vertex(sf::Vector2f((j + 1) * 32, (i + 1) * 32), sf::Vector2f((tx + 1) * 32, (ty + 1) * 32)));
+                    tiles.append(sf::Vertex(sf::Vector2f(j * 32, (i + 1) * 32), sf::Vector2f(tx * 32, (ty + 1) * 32)));
+                }
+            }
 
-                    int tx = tileNumber % (tileset.getSize().x / 32);
-                    int ty = tileNumber / (tileset.getSize().x / 32);
-
-                    sf::Vertex *quad = &tiles[((i * size.x) + j) * 4];
-
-                    quad[0].position = sf::Vector2f(j * 32, i * 32);
-                    quad[1].position = sf::Vector2f((j + 1) * 32, i * 32);
-                    quad[2].position = sf::Vector2f((j + 1) * 32, (i + 1) * 32);
-                    quad[3].position = sf::Vector2f(j * 32, (i + 1) * 32);
+            for(Chunk &chunk : chunks) {
+                chunk.tiles.setPrimitiveType(sf::Quads);
+            }
 
-                    quad[0].texCoords = sf::Vector2f(tx * 32, ty * 32);
-                    quad[1].texCoords = sf::Vector2f((tx + 1) * 32, ty * 32);
-                    quad[2].texCoords = sf::Vector2f((tx + 1) * 32, (ty + 1) * 32);
-                    quad[3].texCoords = sf::Vector2f(tx * 32, (ty + 1) * 32);
+#ifdef OP_VERTEX_BUFFER
+            //The buffers are created by the main thread, since the layer can be built by the loading thread.
+            Utils::MainThread::run([this]() {
+                if(!sf::VertexBuffer::isAvailable()) {
+                    return;
                 }
-            }
+                for(Chunk &chunk : chunks) {
+                    if(chunk.tiles.getVertexCount() == 0) {
+                        continue;
+                    }
+                    chunk.buffer.setPrimitiveType(sf::Quads);
+                    chunk.buffer.setUsage(sf::VertexBuffer::Static);
+                    if(chunk.buffer.create(chunk.tiles.getVertexCount()) && chunk.buffer.update(&chunk.tiles[0])) {
+                        chunk.tiles.clear();
+                    }
+                }
+            });
+#endif
+        }
+
+        MapLayer::MapLayer(sf::Vector2i size, const Elements::TileLayer &tiles, std::shared_ptr<const Elements::TileAtlas> atlas)
+          : MapLayer(size, tiles.decompress().data(), std::move(atlas)) {
         }
 
         void MapLayer::draw(sf::RenderTarget &target, sf::RenderStates states) const {
             states.transform *= getTransform();
 
-            states.texture = &tileset;
-
-            target.draw(tiles, states);
+            states.texture = &atlas->getTexture();
+
+            //Area of the layer seen by the target
+            const sf::View &view = target.getView();
+            sf::FloatRect visible = states.transform.getInverse().transformRect(sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize()));
+            const float chunkSize = MAP_CHUNK_SIZE * 32;
+            int firstX = std::max(0, (int)std::floor(visible.left / chunkSize));
+            int firstY = std::max(0, (int)std::floor(visible.top / chunkSize));
+            int lastX = std::min(chunksCount.x - 1, (int)std::floor((visible.left + visible.width) / chunkSize));
+            int lastY = std::min(chunksCount.y - 1, (int)std::floor((visible.top + visible.height) / chunkSize));
+
+            for(int y = firstY; y <= lastY; y++) {
+                for(int x = firstX; x <= lastX; x++) {
+                    const Chunk &chunk = chunks[y * chunksCount.x + x];
+#ifdef OP_VERTEX_BUFFER
+                    if(chunk.tiles.getVertexCount() == 0) {
+                        target.draw(chunk.buffer, states);
+                        continue;
+                    }
+#endif
+                    target.draw(chunk.tiles, states);
+                }
+            }
         }
 
         Transformation::Transformation(unsigned int const &time, MovementData const md, RotationData const rd, ScaleData const sd, sf::Transform *sprite)
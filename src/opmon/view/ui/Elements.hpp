@@ -31,10 +31,28 @@
  */
 #define F_POW 4
 
+#include <SFML/Config.hpp>
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+/*!
+ * \brief Defined if sf::VertexBuffer is available (SFML 2.5 and later).
+ */
+#define OP_VERTEX_BUFFER
+#include <SFML/Graphics/VertexBuffer.hpp>
+#endif
+
+/*!
+ * \brief The size of the chunks of a MapLayer, in tiles.
+ */
+#define MAP_CHUNK_SIZE 16
 
 #include "../../core/Player.hpp"
 
@@ -46,6 +64,11 @@ class Transform;
 }  // namespace sf
 
 namespace OpMon {
+    namespace Elements {
+        class TileAtlas;
+        class TileLayer;
+    }
+
     /*!
      * \brief Namespace containing the view part.
      */
@@ -53,29 +76,54 @@ namespace OpMon {
 
         /*!
          * \brief A map layer.
+         * \details The layer is divided in chunks of #MAP_CHUNK_SIZE × #MAP_CHUNK_SIZE tiles. Only the chunks visible in the view of the target are drawn.
          */
         class MapLayer : public sf::Drawable, public sf::Transformable {
           private:
             /*!
-             * \brief The map tileset.
+             * \brief A square of tiles of the layer.
              */
-            static sf::Texture tileset;
+            struct Chunk {
+                /*!
+                 * \brief The tiles. Emptied once uploaded in the vertex buffer.
+                 */
+                sf::VertexArray tiles;
+#ifdef OP_VERTEX_BUFFER
+                /*!
+                 * \brief The tiles, stored in the graphic card's memory. Not created if vertex buffers are not supported.
+                 */
+                sf::VertexBuffer buffer;
+#endif
+            };
+            /*!
+             * \brief The tiles of the map.
+             */
+            std::shared_ptr<const Elements::TileAtlas> atlas;
             /*!
              * \brief Method called by RenderTexture::draw.
              */
             virtual void draw(sf::RenderTarget &target, sf::RenderStates stats) const;
             /*!
-             * \brief The tiles.
+             * \brief The chunks, line by line.
+             */
+            std::vector<Chunk> chunks;
+            /*!
+             * \brief The number of chunks in each dimension.
              */
-            sf::VertexArray tiles;
+            sf::Vector2i chunksCount;
 
           public:
             /*!
              * \brief Builds a map layer.
              * \param size The dimentions of the map.
              * \param tilesCode An array containing the tiles codes to build the map.
+             * \param atlas The atlas containing the tiles of the map (see Elements::Map::getAtlas).
+             */
+            MapLayer(sf::Vector2i size, const std::uint16_t tilesCode[], std::shared_ptr<const Elements::TileAtlas> atlas);
+            /*!
+             * \brief Builds a map layer from a compressed layer.
              */
-            MapLayer(sf::Vector2i size, const int tilesCode[]);
+            MapLayer(sf::Vector2i size, const Elements::TileLayer &tiles, std::shared_ptr<const Elements::TileAtlas> atlas);
         };
 
         /*!
@@ -6,95 +6,310 @@ File under GNU GPL v3.0 license
 */
 #include "Jukebox.hpp"
 
-#include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <algorithm>
+#include <chrono>
+#include <future>
 
+#include "src/utils/MusicStream.hpp"
+#include "src/utils/ResourceCache.hpp"
 #include "src/utils/ResourceLoader.hpp"
+#include "src/utils/mainthread.hpp"
+#include "src/utils/threadpool.hpp"
 
 namespace OpMon {
     namespace Ui {
-        void Jukebox::addMusic(const std::string &name, const std::string &path, bool loop) {
-            try {
-                auto music = Utils::ResourceLoader::loadMusic(path.c_str());
-                music->setVolume(globalVolume);
-                music->setLoop(loop);
-                musList[name] = std::move(music);
-            } catch (Utils::LoadingException& e) {
-                Utils::Log::oplog(e.desc(), true);
-                Utils::Log::warn(std::string("Music '") + name + "' failed to load.");
+        MusicId Jukebox::addMusic(const std::string &name, const std::string &path, bool loop) {
+            auto itor = musicIds.find(name);
+            if(itor == musicIds.end()) {
+                itor = musicIds.emplace(name, (MusicId)musList.size()).first;
+                musList.emplace_back();
+            } else {
+                if(playing != nullptr && musList[(std::size_t)itor->second].stream.get() == playing) {
+                    playing = nullptr;
+                }
+                if(pending == itor->second) {
+                    pending = MusicId::NONE;
+                }
+                openMusics.remove(itor->second);
             }
+            musList[(std::size_t)itor->second] = Music{path, loop, nullptr, {}};
+            return itor->second;
         }
 
-        void Jukebox::addSound(const std::string &name, const std::string &path) {
-            try{
-                //Sounds are saved in the code as a pair of sf::SoundBuffer and sf::Sound.
-                auto sb = std::make_unique<sf::SoundBuffer>();
-                Utils::ResourceLoader::load(*sb, path.c_str());
+        MusicId Jukebox::getMusic(const std::string &name) const {
+            auto itor = musicIds.find(name);
+            return itor != musicIds.end() ? itor->second : MusicId::NONE;
+        }
 
-                soundsList[name].first = std::move(sb);
-                soundsList[name].second = std::make_unique<sf::Sound>();
-                soundsList[name].second->setBuffer(*soundsList[name].first);
-                soundsList[name].second->setVolume(globalVolume);
-            } catch (Utils::LoadingException& e) {
-                Utils::Log::oplog(e.desc(), true);
-                Utils::Log::warn(std::string("Sound '") + name + "' failed to load.");
+        void Jukebox::prefetch(MusicId id) {
+            //The screens loaded by the loading thread can play a music while the main thread updates the jukebox
+            if(!Utils::MainThread::isMainThread()) {
+                Utils::MainThread::run([this, id]() { prefetch(id); });
+                return;
+            }
+            if(id == MusicId::NONE || musList[(std::size_t)id].stream || musList[(std::size_t)id].opening.valid()) {
+                return;
             }
+            std::string path = musList[(std::size_t)id].path;
+            musList[(std::size_t)id].opening = Utils::ThreadPool::submit([path]() { return Utils::ResourceLoader::loadMusic(path.c_str()); });
+            touch(id);
         }
 
-        void Jukebox::play(const std::string &music) {
-            if(musList[music].get() == playing) {
+        void Jukebox::prefetch(const std::string &music) {
+            prefetch(getMusic(music));
+        }
+
+        Utils::MusicStream *Jukebox::open(MusicId id) {
+            Music &music = musList[(std::size_t)id];
+            if(!music.stream) {
+                prefetch(id);
+                try {
+                    music.stream = Utils::ThreadPool::wait(music.opening);
+                    music.stream->setVolume(globalVolume);
+                    music.stream->setLooping(music.loop);
+                } catch (Utils::LoadingException& e) {
+                    Utils::Log::oplog(e.desc(), true);
+                    Utils::Log::warn(std::string("Music '") + music.path + "' failed to load.");
+                    return nullptr;
+                }
+            }
+            touch(id);
+            return music.stream.get();
+        }
+
+        void Jukebox::touch(MusicId id) {
+            openMusics.remove(id);
+            openMusics.push_front(id);
+            for(auto itor = openMusics.end(); openMusics.size() > JUKEBOX_OPEN_MUSICS && itor != openMusics.begin();) {
+                --itor;
+                Music &music = musList[(std::size_t)*itor];
+                //The musics playing, fading out or waiting to be played are kept
+                if(*itor == pending || (music.stream && (music.stream.get() == playing || music.stream->getStatus() == sf::SoundSource::Playing))) {
+                    continue;
+                }
+                music.stream.reset();
+                music.opening = {};
+                itor = openMusics.erase(itor);
+            }
+        }
+
+        void Jukebox::start(MusicId id) {
+            Utils::MusicStream *stream = musList[(std::size_t)id].stream.get();
+            if(playing != nullptr && playing != stream) {
+                playing->fade(0, fadeDuration, true);
+            }
+            //A music still fading out fades in again from its current level
+            if(stream->getStatus() != sf::SoundSource::Playing || stream->isFadedOut()) {
+                if(stream->getStatus() == sf::SoundSource::Playing) {
+                    stream->stop();
+                }
+                stream->setGain(0);
+                stream->fade(1, fadeDuration, false);
+                stream->play();
+            } else {
+                stream->fade(1, fadeDuration, false);
+            }
+            playing = stream;
+            touch(id);
+        }
+
+        void Jukebox::update() {
+            if(pending == MusicId::NONE) {
                 return;
             }
+            std::future<std::unique_ptr<Utils::MusicStream>> &opening = musList[(std::size_t)pending].opening;
+            if(opening.valid() && opening.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                return;
+            }
+            MusicId id = pending;
+            pending = MusicId::NONE;
+            if(open(id) != nullptr) {
+                start(id);
+            }
+        }
 
-            if(playing != nullptr) {
-                playing->stop();
+        SoundId Jukebox::addSound(const std::string &name, const std::string &path) {
+            addSounds({{name, path}});
+            return getSound(name);
+        }
+
+        void Jukebox::addSounds(std::vector<std::pair<std::string, std::string>> const &sounds) {
+            std::vector<std::future<std::shared_ptr<const sf::SoundBuffer>>> buffers;
+            for(auto const &sound : sounds) {
+                buffers.push_back(Utils::ResourceCache::loadSoundBuffer(sound.second));
             }
+            for(std::size_t i = 0; i < sounds.size(); i++) {
+                const std::string &name = sounds[i].first;
+                try{
+                    std::shared_ptr<const sf::SoundBuffer> buffer = Utils::ThreadPool::wait(buffers[i]);
+                    auto itor = soundIds.find(name);
+                    if(itor == soundIds.end()) {
+                        itor = soundIds.emplace(name, (SoundId)soundsList.size()).first;
+                        soundsList.emplace_back();
+                    } else {
+                        //The voices playing the previous buffer are stopped before it is released
+                        for(Voice &voice : voices) {
+                            if(voice.playing == itor->second) {
+                                voice.sound.stop();
+                                voice.sound.resetBuffer();
+                                voice.playing = SoundId::NONE;
+                            }
+                        }
+                    }
+                    soundsList[(std::size_t)itor->second].buffer = std::move(buffer);
+                } catch (Utils::LoadingException& e) {
+                    Utils::Log::oplog(e.desc(), true);
+                    Utils::Log::warn(std::string("Sound '") + name + "' failed to load.");
+                }
+            }
+        }
 
-            if(musList[music].get() == nullptr) {
-                Utils::Log::warn(std::string("Unknown music '") + music + "'");
+        SoundId Jukebox::getSound(const std::string &name) const {
+            auto itor = soundIds.find(name);
+            return itor != soundIds.end() ? itor->second : SoundId::NONE;
+        }
+
+        void Jukebox::setPolyphony(SoundId sound, unsigned int polyphony) {
+            if(sound != SoundId::NONE) {
+                soundsList[(std::size_t)sound].polyphony = std::max(1u, polyphony);
+            }
+        }
+
+        void Jukebox::play(MusicId music) {
+            if(!Utils::MainThread::isMainThread()) {
+                Utils::MainThread::run([this, music]() { play(music); });
+                return;
+            }
+            if(music != MusicId::NONE && playing != nullptr && musList[(std::size_t)music].stream.get() == playing) {
+                pending = MusicId::NONE;
+                return;
+            }
+
+            pending = MusicId::NONE;
+            if(music == MusicId::NONE) {
+                if(playing != nullptr) {
+                    playing->fade(0, fadeDuration, true);
+                    playing = nullptr;
+                }
                 return;
             }
 
-            musList.at(music)->play();
-            playing = musList.at(music).get();
+            //The current music keeps playing while the new one is opened
+            if(musList[(std::size_t)music].stream) {
+                start(music);
+            } else {
+                prefetch(music);
+                pending = music;
+            }
+        }
+
+        void Jukebox::play(const std::string &music) {
+            MusicId id = getMusic(music);
+            if(id == MusicId::NONE) {
+                Utils::Log::warn(std::string("Unknown music '") + music + "'");
+            }
+            play(id);
         }
 
         void Jukebox::pause() {
-            if(playing != nullptr) {
-                playing->pause();
+            if(!Utils::MainThread::isMainThread()) {
+                Utils::MainThread::run([this]() { pause(); });
+                return;
+            }
+            pending = MusicId::NONE;
+            for(Music &music : musList) {
+                if(music.stream && music.stream.get() == playing) {
+                    playing->pause();
+                } else if(music.stream && music.stream->getStatus() == sf::SoundSource::Playing) {
+                    music.stream->stop();
+                }
             }
             playing = nullptr;
         }
 
         void Jukebox::stop() {
-            if(playing != nullptr) {
-                playing->stop();
+            if(!Utils::MainThread::isMainThread()) {
+                Utils::MainThread::run([this]() { stop(); });
+                return;
+            }
+            pending = MusicId::NONE;
+            for(Music &music : musList) {
+                if(music.stream && (music.stream.get() == playing || music.stream->getStatus() == sf::SoundSource::Playing)) {
+                    music.stream->stop();
+                }
             }
             playing = nullptr;
         }
 
+        void Jukebox::setFadeDuration(sf::Time fadeDuration) {
+            this->fadeDuration = fadeDuration;
+        }
+
         void Jukebox::setGlobalVolume(float globalVolume) {
             if(globalVolume > 100 || globalVolume < 0) {
                 Utils::Log::warn(std::string("Volume greater than 100 or lesser than 0."));
                 return;
             }
 
-            for(auto itor = musList.begin(); itor != musList.end(); ++itor) {
-                itor->second->setVolume(globalVolume);
+            for(Music &music : musList) {
+                if(music.stream) {
+                    music.stream->setVolume(globalVolume);
+                }
             }
-            for(auto itor = soundsList.begin(); itor != soundsList.end(); ++itor) {
-                itor->second.second->setVolume(globalVolume);
+            for(Voice &voice : voices) {
+                voice.sound.setVolume(globalVolume);
             }
             this->globalVolume = globalVolume;
         }
 
+        void Jukebox::playSound(SoundId sound) {
+            if(sound == SoundId::NONE) {
+                return;
+            }
+
+            //Finds a free voice, or the oldest voice to reuse
+            Voice *free = nullptr;
+            Voice *oldest = nullptr;
+            Voice *oldestSame = nullptr;
+            unsigned int playingSame = 0;
+            for(Voice &voice : voices) {
+                if(voice.sound.getStatus() != sf::Sound::Playing) {
+                    if(free == nullptr) {
+                        free = &voice;
+                    }
+                    continue;
+                }
+                if(voice.playing == sound) {
+                    playingSame++;
+                    if(oldestSame == nullptr || voice.started < oldestSame->started) {
+                        oldestSame = &voice;
+                    }
+                }
+                if(oldest == nullptr || voice.started < oldest->started) {
+                    oldest = &voice;
+                }
+            }
+            Voice &voice = playingSame >= soundsList[(std::size_t)sound].polyphony ? *oldestSame : (free != nullptr ? *free : *oldest);
+
+            voice.sound.stop();
+            if(voice.playing != sound) {
+                voice.sound.setBuffer(*soundsList[(std::size_t)sound].buffer);
+                voice.playing = sound;
+            }
+            voice.sound.setVolume(globalVolume);
+            voice.started = ++soundsPlayed;
+            voice.sound.play();
+        }
+
         void Jukebox::playSound(const std::string &sound) {
-            if(soundsList[sound].first.get() == nullptr) {
+            SoundId id = getSound(sound);
+            if(id == SoundId::NONE) {
                 Utils::Log::warn(std::string("Unknown sound '") + sound + "'");
                 return;
             }
-            soundsList.at(sound).second->play();
+            playSound(id);
         }
 
         int Jukebox::getGlobalVolume() const {
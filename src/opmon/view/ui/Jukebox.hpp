@@ -12,86 +12,264 @@
 */
 #pragma once
 
-#include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/Time.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "src/utils/MusicStream.hpp"
 #include "src/utils/ResourceLoader.hpp"
 
 namespace sf {
-class Music;
 class Sound;
 class SoundBuffer;
 }  // namespace sf
 
+/*!
+ * \brief The maximal number of musics kept open by the Jukebox, including the one playing.
+ */
+#define JUKEBOX_OPEN_MUSICS 3
+/*!
+ * \brief The default duration of the crossfade between two musics, in milliseconds.
+ */
+#define JUKEBOX_FADE_DURATION 1000
+/*!
+ * \brief The number of sounds the Jukebox can play at the same time.
+ */
+#define JUKEBOX_VOICES 16
+/*!
+ * \brief The default number of times the same sound can be played at the same time.
+ */
+#define JUKEBOX_POLYPHONY 4
+
 namespace OpMon {
     namespace Ui {
 
+        /*!
+         * \brief Identifies a sound added to the Jukebox (see Jukebox::getSound).
+         */
+        enum class SoundId : std::size_t { NONE = SIZE_MAX };
+        /*!
+         * \brief Identifies a music added to the Jukebox (see Jukebox::getMusic).
+         */
+        enum class MusicId : std::size_t { NONE = SIZE_MAX };
+
         /*!
          * \brief Class managing the audio in the game.
+         * \details The musics are streamed from their files. A music is opened on the thread pool the first time it is played, or when it is prefetched,
+         * and the least recently used musics are closed when more than JUKEBOX_OPEN_MUSICS are open. Opening a music decodes its beginning
+         * (see Utils::MusicStream), so changing the music never reads a file on the main thread : the new music starts, in update(), once it is open.
+         * The previous music keeps playing until then, and is crossfaded with the new one.
+         *
+         * The sounds are played by a pool of JUKEBOX_VOICES voices, so a sound played again doesn't cut the previous one.
+         * When all the voices are busy, or when a sound is played more times than its polyphony, the oldest voice is reused.
+         *
+         * The names of the sounds and musics are only used to get their identifiers, which should be kept by the code playing them.
+         *
+         * The musics are managed on the main thread : when called from another thread, prefetch(), play(), pause() and stop() are run with Utils::MainThread::run.
          */
         class Jukebox {
           private:
             /*!
-             * \brief A map of the different musics in the game.
+             * \brief A music added to the jukebox.
+             */
+            struct Music {
+                std::string path;
+                bool loop;
+                /*!
+                 * \brief The stream of the music, `nullptr` if it isn't open.
+                 */
+                std::unique_ptr<Utils::MusicStream> stream;
+                /*!
+                 * \brief The stream being opened on the thread pool, if the music has been prefetched.
+                 */
+                std::future<std::unique_ptr<Utils::MusicStream>> opening;
+            };
+
+            /*!
+             * \brief A sound added to the jukebox.
+             */
+            struct Sound {
+                /*!
+                 * \brief The buffer of the sound, shared with the other users of the file.
+                 */
+                std::shared_ptr<const sf::SoundBuffer> buffer;
+                /*!
+                 * \brief The maximal number of voices playing the sound at the same time.
+                 */
+                unsigned int polyphony = JUKEBOX_POLYPHONY;
+            };
+
+            /*!
+             * \brief A voice of the pool playing the sounds.
+             */
+            struct Voice {
+                sf::Sound sound;
+                SoundId playing = SoundId::NONE;
+                /*!
+                 * \brief When the voice has started playing, used to find the oldest voice.
+                 */
+                std::uint64_t started = 0;
+            };
+
+            /*!
+             * \brief The different musics in the game, indexed by their identifiers.
+             */
+            std::vector<Music> musList;
+            std::unordered_map<std::string, MusicId> musicIds;
+            /*!
+             * \brief The open or prefetched musics, from the most recently used to the least recently used.
+             */
+            std::list<MusicId> openMusics;
+            /*!
+             * \brief The different sounds in the game, indexed by their identifiers.
+             */
+            std::vector<Sound> soundsList;
+            std::unordered_map<std::string, SoundId> soundIds;
+            /*!
+             * \brief The voices playing the sounds. Declared after the sounds, so they are destroyed before the buffers.
              */
-            std::unordered_map<std::string, std::unique_ptr<sf::Music>> musList;
+            std::array<Voice, JUKEBOX_VOICES> voices;
             /*!
-             * \brief A map of the different sounds in the game.
+             * \brief The number of sounds played since the creation of the jukebox.
              */
-            std::unordered_map<std::string, std::pair<std::unique_ptr<sf::SoundBuffer>, std::unique_ptr<sf::Sound> > > soundsList;
+            std::uint64_t soundsPlayed = 0;
             /*!
              * \brief A pointer to the currently playing music.
              */
-            sf::Music *playing{nullptr};
+            Utils::MusicStream *playing{nullptr};
+            /*!
+             * \brief The music to play once it is open, MusicId::NONE if there is none.
+             */
+            MusicId pending = MusicId::NONE;
+            sf::Time fadeDuration = sf::milliseconds(JUKEBOX_FADE_DURATION);
             /*!
              * \brief The global volume of the musics and sounds.
              */
             float globalVolume{50.0};
 
+            /*!
+             * \brief Returns the stream of a music, waiting for it to be opened by prefetch() if needed.
+             * \returns The stream, or `nullptr` if it can't be opened.
+             */
+            Utils::MusicStream *open(MusicId id);
+            /*!
+             * \brief Crossfades the playing music with an open music.
+             */
+            void start(MusicId id);
+            /*!
+             * \brief Marks a music as the most recently used, and closes the least recently used ones.
+             */
+            void touch(MusicId id);
+
           public:
             Jukebox() = default;
             ~Jukebox() = default;
 
             /*!
              * \brief Adds a music to the jukebox.
+             * \details The file is only opened when the music is played or prefetched.
              * \param name The string to associate with the music.
              * \param path The path of the music.
              * \param loop Sets if the music has to loop or not.
+             * \returns The identifier of the music.
+             */
+            MusicId addMusic(const std::string &name, const std::string &path, bool loop = true);
+
+            /*!
+             * \brief Returns the identifier of a music.
+             * \returns The identifier, or MusicId::NONE if the music is unknown.
+             */
+            MusicId getMusic(const std::string &name) const;
+
+            /*!
+             * \brief Opens a music in the background, so it starts without delay when it is played.
+             * \param music The identifier of the music. Nothing is done if it is MusicId::NONE.
+             */
+            void prefetch(MusicId music);
+            /*!
+             * \brief Opens a music in the background, so it starts without delay when it is played.
+             * \param music The string identifier of the music. Nothing is done if it is unknown.
+             */
+            void prefetch(const std::string &music);
+
+            /*!
+             * \brief Starts the music waiting to be opened, if it is ready.
+             * \details Must be called every frame.
              */
-            void addMusic(const std::string &name, const std::string &path, bool loop = true);
+            void update();
 
+            /*!
+             * \brief Plays the selected music.
+             * \param music The identifier of the music.
+             * \details If the music to play is already playing, the method will not restart the music. Otherwise, the music currently playing
+             * is crossfaded with the new one once it is open. Playing MusicId::NONE fades out the current music.
+             */
+            void play(MusicId music);
             /*!
              * \brief Plays the selected music.
              * \param music The string identifier of the music.
-             * \details If the music to play is already playing, the method will not restart the music. The method will replace any other music currently playing.
+             * \details Prefer play(MusicId) for the musics known in advance.
              */
             void play(const std::string &music);
             /*!
-             * \brief Pauses the current music.
+             * \brief Pauses the current music, and stops the musics fading out.
              */
             void pause();
             /*!
-             * \brief Stops the current music.
+             * \brief Stops the current music, and the musics fading out.
              */
             void stop();
 
+            /*!
+             * \brief Sets the duration of the crossfade between two musics.
+             */
+            void setFadeDuration(sf::Time fadeDuration);
+
             void setGlobalVolume(float globalVolume);
             int getGlobalVolume() const;
 
+            /*!
+             * \brief Plays the selected sound.
+             * \param sound The identifier of the sound to play. Nothing is done if it is SoundId::NONE.
+             */
+            void playSound(SoundId sound);
             /*!
              * \brief Plays the selected sound.
              * \param sound The string identifier of the sound to play.
+             * \details Prefer playSound(SoundId) for the sounds known in advance.
              */
             void playSound(const std::string &sound);
+            /*!
+             * \brief Returns the identifier of a sound.
+             * \returns The identifier, or SoundId::NONE if the sound is unknown.
+             */
+            SoundId getSound(const std::string &name) const;
             /*!
              * \brief Adds a sound to the jukebox.
              * \param name The string to associate with the sound.
              * \param path The path of the sound.
+             * \returns The identifier of the sound.
+             */
+            SoundId addSound(const std::string &name, const std::string &path);
+            /*!
+             * \brief Adds many sounds to the jukebox, decoded in parallel.
+             * \param sounds The names and paths of the sounds.
+             */
+            void addSounds(std::vector<std::pair<std::string, std::string>> const &sounds);
+            /*!
+             * \brief Sets the maximal number of times a sound can be played at the same time.
+             * \details When the limit is reached, the oldest voice playing the sound is restarted. The default is JUKEBOX_POLYPHONY.
              */
-            void addSound(const std::string &name, const std::string &path);
+            void setPolyphony(SoundId sound, unsigned int polyphony);
         };
 
     } // namespace Ui
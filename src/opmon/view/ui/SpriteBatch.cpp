@@ -0,0 +1,61 @@
+/*
+SpriteBatch.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "SpriteBatch.hpp"
+
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <cmath>
+
+namespace OpMon {
+    namespace Ui {
+
+        void SpriteBatch::clear() {
+            vertices.clear();
+            batches.clear();
+        }
+
+        void SpriteBatch::add(const sf::Sprite &sprite, sf::Vector2f position) {
+            const sf::Texture *texture = sprite.getTexture();
+            if(texture == nullptr) {
+                return;
+            }
+
+            //Same vertices as sf::Sprite, moved to the given position
+            sf::Transform transform;
+            transform.translate(position - sprite.getPosition());
+            transform *= sprite.getTransform();
+            const sf::IntRect &rect = sprite.getTextureRect();
+            float width = std::abs(rect.width);
+            float height = std::abs(rect.height);
+            float left = rect.left;
+            float right = left + rect.width;
+            float top = rect.top;
+            float bottom = top + rect.height;
+            vertices.emplace_back(transform.transformPoint(0, 0), sprite.getColor(), sf::Vector2f(left, top));
+            vertices.emplace_back(transform.transformPoint(width, 0), sprite.getColor(), sf::Vector2f(right, top));
+            vertices.emplace_back(transform.transformPoint(width, height), sprite.getColor(), sf::Vector2f(right, bottom));
+            vertices.emplace_back(transform.transformPoint(0, height), sprite.getColor(), sf::Vector2f(left, bottom));
+
+            if(batches.empty() || batches.back().texture != texture) {
+                batches.push_back({texture, 0});
+            }
+            batches.back().verticesCount += 4;
+        }
+
+        void SpriteBatch::draw(sf::RenderTarget &target, sf::RenderStates states) const {
+            std::size_t first = 0;
+            for(const Batch &batch : batches) {
+                states.texture = batch.texture;
+                target.draw(vertices.data() + first, batch.verticesCount, sf::Quads, states);
+                first += batch.verticesCount;
+            }
+        }
+
+    } // namespace Ui
+} // namespace OpMon
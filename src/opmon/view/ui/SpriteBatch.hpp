@@ -0,0 +1,66 @@
+/*!
+ * \file SpriteBatch.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace sf {
+    class RenderTarget;
+    class Sprite;
+    class Texture;
+}  // namespace sf
+
+namespace OpMon {
+    namespace Ui {
+
+        /*!
+         * \brief Draws many sprites with few draw calls.
+         * \details The sprites are drawn in the order they are added. The consecutive sprites using the same texture are drawn together, in one draw call.
+         * The batch keeps its memory between two frames : it must be cleared before adding the sprites of a new frame.
+         */
+        class SpriteBatch : public sf::Drawable {
+          public:
+            /*!
+             * \brief Removes the sprites of the batch.
+             */
+            void clear();
+
+            /*!
+             * \brief Adds a sprite at the end of the batch. The sprites without texture are ignored.
+             * \param sprite The sprite to add. Its vertices are copied : it can be modified once added.
+             * \param position The position at which the sprite is drawn, instead of its own position.
+             */
+            void add(const sf::Sprite &sprite, sf::Vector2f position);
+
+            /*!
+             * \returns The number of draw calls needed to draw the batch.
+             */
+            std::size_t getDrawCallsCount() const {
+                return batches.size();
+            }
+
+          private:
+            /*!
+             * \brief Consecutive sprites using the same texture.
+             */
+            struct Batch {
+                const sf::Texture *texture;
+                std::size_t verticesCount;
+            };
+
+            virtual void draw(sf::RenderTarget &target, sf::RenderStates states) const;
+
+            std::vector<sf::Vertex> vertices;
+            std::vector<Batch> batches;
+        };
+
+    } // namespace Ui
+} // namespace OpMon
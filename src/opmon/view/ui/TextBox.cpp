@@ -5,8 +5,8 @@
 #include <SFML/Graphics/Vertex.hpp>
 
 namespace OpMon{
-    TextBox::TextBox(sf::Texture texture, sf::Vector2f position, uint32_t width, uint32_t height, uint32_t linesCount)
-        : texture(texture)
+    TextBox::TextBox(std::shared_ptr<const sf::Texture> texture, sf::Vector2f position, uint32_t width, uint32_t height, uint32_t linesCount)
+        : texture(std::move(texture))
         , position(position)
         , width(width)
         , height(height) {
@@ -104,7 +104,7 @@ namespace OpMon{
     }
 
     void TextBox::draw(sf::RenderTarget &target, sf::RenderStates states) const {
-        states.texture = &this->texture;
+        states.texture = this->texture.get();
         target.draw(this->vertexArray, states);
 
         for (auto& text : leftText) {
@@ -15,6 +15,7 @@
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <memory>
 
 namespace sf {
     class RenderTarget;
@@ -28,7 +29,7 @@ namespace OpMon{
         sf::VertexArray vertexArray = sf::VertexArray(sf::Quads, 36);
 
         /// \brief The texture used to draw the box
-        sf::Texture texture;
+        std::shared_ptr<const sf::Texture> texture;
 
         /// \brief The position of the box
         sf::Vector2f position;
@@ -67,7 +68,7 @@ namespace OpMon{
          * \param height The height of the box.
          * \param linesCount The number of lines of text to display in the box.
          */
-        TextBox(sf::Texture texture, sf::Vector2f position, uint32_t width, uint32_t height, uint32_t linesCount = 1);
+        TextBox(std::shared_ptr<const sf::Texture> texture, sf::Vector2f position, uint32_t width, uint32_t height, uint32_t linesCount = 1);
 
         ~TextBox() = default;
 
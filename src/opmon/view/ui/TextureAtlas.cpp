@@ -0,0 +1,204 @@
+/*
+TextureAtlas.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "TextureAtlas.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+
+#include "src/utils/ResourceLoader.hpp"
+#include "src/utils/log.hpp"
+#include "src/utils/mainthread.hpp"
+#include "src/utils/threadpool.hpp"
+
+//Transparent pixels left between two frames, so a frame drawn at a non-integer position doesn't show its neighbours
+#define ATLAS_PADDING 1
+
+namespace {
+    //Position of the next frame in a page. The frames are placed in rows, from left to right.
+    struct Shelf {
+        unsigned int x = 0;
+        unsigned int y = 0;
+        unsigned int height = 0;
+    };
+
+    //Places the frames of an animation from the given position. Returns false if they don't fit in the page.
+    bool place(const std::vector<sf::Image> &images, Shelf &shelf, std::vector<sf::IntRect> &rects) {
+        rects.clear();
+        for(const sf::Image &image : images) {
+            sf::Vector2u size = image.getSize();
+            if(shelf.x + size.x > ATLAS_PAGE_SIZE) {
+                shelf.x = 0;
+                shelf.y += shelf.height;
+                shelf.height = 0;
+            }
+            if(shelf.x + size.x > ATLAS_PAGE_SIZE || shelf.y + size.y > ATLAS_PAGE_SIZE) {
+                return false;
+            }
+            rects.emplace_back(shelf.x, shelf.y, size.x, size.y);
+            shelf.x += size.x + ATLAS_PADDING;
+            shelf.height = std::max(shelf.height, size.y + ATLAS_PADDING);
+        }
+        return true;
+    }
+} // namespace
+
+namespace OpMon {
+    namespace Ui {
+
+        void TextureAtlas::declare(const std::string &key, const std::string &path, std::size_t count, std::size_t offset) {
+            std::lock_guard<std::mutex> lock(mutex);
+            Animation &animation = animations[key];
+            animation.path = path;
+            animation.count = count;
+            animation.offset = offset;
+        }
+
+        std::shared_ptr<const Frames> TextureAtlas::acquire(const std::string &key) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto itor = animations.find(key);
+            if(itor == animations.end()) {
+                return nullptr;
+            }
+            Animation &animation = itor->second;
+            std::shared_ptr<const Frames> frames = animation.users.lock();
+            if(frames) {
+                return frames;
+            }
+
+            PendingFrames loaded{key, ++animation.generation, {}};
+            for(std::size_t i = 0; i < animation.count; ++i) {
+                char buffer[2048];
+                snprintf(buffer, 2048, animation.path.c_str(), i + animation.offset);
+                loaded.images.push_back(Utils::ResourceLoader::loadImage(buffer));
+            }
+            pending.push_back(std::move(loaded));
+
+            //The frames belong to the atlas : the pointer only counts the users
+            unsigned int generation = animation.generation;
+            frames = std::shared_ptr<const Frames>(&animation.frames, [this, key, generation](const Frames *) { release(key, generation); });
+            animation.users = frames;
+            return frames;
+        }
+
+        void TextureAtlas::release(const std::string &key, unsigned int generation) {
+            std::list<Page> unused;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                Animation &animation = animations.at(key);
+                if(animation.generation != generation) {
+                    return;
+                }
+                std::erase_if(pending, [&key](PendingFrames const &frames) { return frames.key == key; });
+                for(auto page = pages.begin(); page != pages.end(); ++page) {
+                    if(&page->texture == animation.frames.texture) {
+                        if(--page->users == 0) {
+                            unused.splice(unused.begin(), pages, page);
+                        }
+                        break;
+                    }
+                }
+                animation.frames = Frames();
+            }
+            if(!unused.empty()) {
+                Utils::MainThread::run([&unused]() { unused.clear(); });
+            }
+        }
+
+        void TextureAtlas::pack() {
+            std::vector<PendingFrames> loaded;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                loaded.swap(pending);
+            }
+            if(loaded.empty()) {
+                return;
+            }
+            std::vector<std::vector<sf::Image>> images(loaded.size());
+            for(std::size_t i = 0; i < loaded.size(); i++) {
+                for(std::future<sf::Image> &image : loaded[i].images) {
+                    images[i].push_back(Utils::ThreadPool::wait(image));
+                }
+            }
+
+            //Places the frames, without holding the lock since the pages are uploaded by the main thread
+            std::vector<std::vector<sf::IntRect>> rects(loaded.size());
+            std::list<Page> newPages;
+            sf::Image image;
+            image.create(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, sf::Color::Transparent);
+            Shelf shelf;
+            sf::Vector2u used(0, 0);
+
+            //Uploads the current page, and starts a new one
+            auto flush = [&]() {
+                if(used.x == 0 || used.y == 0) {
+                    return;
+                }
+                sf::Texture &texture = newPages.emplace_back().texture;
+                sf::IntRect area(0, 0, used.x, used.y);
+                Utils::MainThread::run([&texture, &image, area]() { texture.loadFromImage(image, area); });
+                image.create(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, sf::Color::Transparent);
+                shelf = Shelf();
+                used = sf::Vector2u(0, 0);
+            };
+
+            std::vector<std::size_t> pageIndex(loaded.size());
+            for(std::size_t i = 0; i < loaded.size(); i++) {
+                Shelf next = shelf;
+                if(!place(images[i], next, rects[i])) {
+                    flush();
+                    next = shelf;
+                    if(!place(images[i], next, rects[i])) {
+                        Utils::Log::warn("The frames of " + loaded[i].key + " don't fit in a texture of " + std::to_string(ATLAS_PAGE_SIZE) + " pixels.");
+                        rects[i].clear();
+                        pageIndex[i] = SIZE_MAX;
+                        continue;
+                    }
+                }
+                shelf = next;
+                for(std::size_t frame = 0; frame < rects[i].size(); frame++) {
+                    const sf::IntRect &rect = rects[i][frame];
+                    image.copy(images[i][frame], rect.left, rect.top);
+                    used.x = std::max<unsigned int>(used.x, rect.left + rect.width);
+                    used.y = std::max<unsigned int>(used.y, rect.top + rect.height);
+                }
+                pageIndex[i] = newPages.size();
+            }
+            flush();
+
+            std::list<Page> unused;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::vector<Page *> indexedPages;
+                for(Page &page : newPages) {
+                    indexedPages.push_back(&page);
+                }
+                for(std::size_t i = 0; i < loaded.size(); i++) {
+                    Animation &animation = animations.at(loaded[i].key);
+                    //The animation may have been released while it was packed
+                    if(animation.generation != loaded[i].generation || pageIndex[i] >= indexedPages.size()) {
+                        continue;
+                    }
+                    animation.frames.rects = std::move(rects[i]);
+                    animation.frames.texture = &indexedPages[pageIndex[i]]->texture;
+                    indexedPages[pageIndex[i]]->users++;
+                }
+                for(auto page = newPages.begin(); page != newPages.end();) {
+                    auto next = std::next(page);
+                    std::list<Page> &destination = page->users == 0 ? unused : pages;
+                    destination.splice(destination.end(), newPages, page);
+                    page = next;
+                }
+            }
+            if(!unused.empty()) {
+                Utils::MainThread::run([&unused]() { unused.clear(); });
+            }
+        }
+
+    } // namespace Ui
+} // namespace OpMon
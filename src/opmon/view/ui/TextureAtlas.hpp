@@ -0,0 +1,145 @@
+/*!
+ * \file TextureAtlas.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <cstddef>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief The maximal size of the textures of a TextureAtlas, in pixels.
+ */
+#define ATLAS_PAGE_SIZE 2048
+
+namespace OpMon {
+    namespace Ui {
+
+        /*!
+         * \brief The frames of an animation, in a texture of a TextureAtlas.
+         */
+        struct Frames {
+            /*!
+             * \brief The texture containing all the frames. `nullptr` if the frames couldn't be loaded, or haven't been packed yet.
+             */
+            const sf::Texture *texture = nullptr;
+            /*!
+             * \brief The rectangle of each frame in the texture.
+             */
+            std::vector<sf::IntRect> rects;
+
+            std::size_t size() const {
+                return rects.size();
+            }
+        };
+
+        /*!
+         * \brief Packs the frames of many animations in a few large textures (the pages).
+         * \details The animations are first declared with TextureAtlas::declare. An animation starts loading the first time it is acquired with
+         * TextureAtlas::acquire, then is put in a page by the next call to TextureAtlas::pack, with the other animations acquired in the meantime.
+         * The frames of all these animations are decoded in parallel, and TextureAtlas::pack waits for them.
+         * It is unloaded when it isn't used anymore, and a page is destroyed when none of its animations is used.
+         *
+         * All the frames of an animation are put in the same page, so the texture doesn't change while the animation is played, and the sprites
+         * using the same page can be drawn together (see SpriteBatch).
+         *
+         * The methods can be called from any thread : the pages are created and destroyed by the main thread (see Utils::MainThread).
+         */
+        class TextureAtlas {
+          public:
+            TextureAtlas() = default;
+            TextureAtlas(TextureAtlas const &) = delete;
+            TextureAtlas &operator=(TextureAtlas const &) = delete;
+
+            /*!
+             * \brief Declares an animation, loaded when it is acquired for the first time.
+             * \param key The name of the animation.
+             * \param path The path of the frames, relative to the resource folder. It must contain a "%d", which is replaced by the frame number.
+             * \param count The number of frames.
+             * \param offset The number of the first frame.
+             */
+            void declare(const std::string &key, const std::string &path, std::size_t count, std::size_t offset = 0);
+
+            /*!
+             * \brief Returns the frames of an animation, and loads them if they aren't used yet.
+             * \details The frames of an animation which has just been loaded are empty until the next call to TextureAtlas::pack.
+             * They stay at the same address as long as the atlas exists.
+             * \returns The frames, unloaded when the last copy of the pointer is destroyed, or `nullptr` if the animation hasn't been declared.
+             */
+            std::shared_ptr<const Frames> acquire(const std::string &key);
+
+            /*!
+             * \brief Puts the frames loaded since the last call in new pages.
+             */
+            void pack();
+
+            std::size_t getPagesCount() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return pages.size();
+            }
+
+          private:
+            /*!
+             * \brief A declared animation.
+             */
+            struct Animation {
+                std::string path;
+                std::size_t count;
+                std::size_t offset;
+                Frames frames;
+                /*!
+                 * \brief The frames given by TextureAtlas::acquire, if they are used.
+                 */
+                std::weak_ptr<const Frames> users;
+                /*!
+                 * \brief Incremented each time the animation is loaded, so an old pointer being destroyed doesn't unload the animation again.
+                 */
+                unsigned int generation = 0;
+            };
+
+            /*!
+             * \brief An animation loaded, but not packed yet.
+             */
+            struct PendingFrames {
+                std::string key;
+                unsigned int generation;
+                /*!
+                 * \brief The frames, decoded on the thread pool (see Utils::ThreadPool).
+                 */
+                std::vector<std::future<sf::Image>> images;
+            };
+
+            struct Page {
+                sf::Texture texture;
+                /*!
+                 * \brief The number of loaded animations in the page.
+                 */
+                std::size_t users = 0;
+            };
+
+            /*!
+             * \brief Unloads an animation, called when the last pointer given by TextureAtlas::acquire is destroyed.
+             */
+            void release(const std::string &key, unsigned int generation);
+
+            mutable std::mutex mutex;
+            std::vector<PendingFrames> pending;
+            std::map<std::string, Animation> animations;
+            /*!
+             * \brief The textures. A list is used, since the frames point to them.
+             */
+            std::list<Page> pages;
+        };
+
+    } // namespace Ui
+} // namespace OpMon
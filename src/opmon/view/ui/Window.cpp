@@ -21,6 +21,9 @@ File under GNU GPL v3.0 license
 #include "../../../utils/log.hpp"
 #include "src/utils/ResourceLoader.hpp"
 
+//Maximum framerate used when the vertical synchronization is disabled
+#define FRAMERATE_LIMIT 144
+
 using Utils::Log::oplog;
 
 namespace OpMon {
@@ -47,8 +50,15 @@ namespace OpMon {
             updateView();
 
             oplog("Window initialized!");
-            //window.setVerticalSyncEnabled(true);
-            window.setFramerateLimit(30);
+            //The game speed doesn't depend on the framerate (see GameLoop), so the frames can be drawn at the display rate.
+            if(!options.checkParam("vsync")) {
+                options.addOrModifParam("vsync", "true");
+            }
+            if(options.getParam("vsync").getValue() == "true") {
+                window.setVerticalSyncEnabled(true);
+            } else {
+                window.setFramerateLimit(FRAMERATE_LIMIT);
+            }
             window.setKeyRepeatEnabled(false);
         }
 
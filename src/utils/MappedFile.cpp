@@ -0,0 +1,99 @@
+/*
+MappedFile.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Utils {
+
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+#ifdef _WIN32
+
+    bool MappedFile::open(const std::string &path) {
+        close();
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER fileSize;
+        if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mapping == nullptr) {
+            CloseHandle(file);
+            return false;
+        }
+        void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(view == nullptr) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+        fileHandle = file;
+        mappingHandle = mapping;
+        data = (const char *)view;
+        size = (std::size_t)fileSize.QuadPart;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if(data != nullptr) {
+            UnmapViewOfFile(data);
+            CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+        }
+        data = nullptr;
+        size = 0;
+        fileHandle = nullptr;
+        mappingHandle = nullptr;
+    }
+
+#else
+
+    bool MappedFile::open(const std::string &path) {
+        close();
+        int file = ::open(path.c_str(), O_RDONLY);
+        if(file < 0) {
+            return false;
+        }
+        struct stat fileStat;
+        if(fstat(file, &fileStat) != 0 || fileStat.st_size == 0) {
+            ::close(file);
+            return false;
+        }
+        void *view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file); //The mapping stays valid after the file is closed.
+        if(view == MAP_FAILED) {
+            return false;
+        }
+        data = (const char *)view;
+        size = (std::size_t)fileStat.st_size;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if(data != nullptr) {
+            munmap((void *)data, size);
+        }
+        data = nullptr;
+        size = 0;
+    }
+
+#endif
+
+} // namespace Utils
@@ -0,0 +1,62 @@
+/*!
+ * \file MappedFile.hpp
+ * \brief Read-only memory mapping of a file.
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Utils {
+
+    /*!
+     * \brief A file mapped in memory, in read only mode.
+     * \details The content of the file is read by the system when it is accessed, so opening a big file costs nothing until its data is used.
+     * The data stays valid until the object is closed or destroyed.
+     */
+    class MappedFile {
+      public:
+        MappedFile() = default;
+        ~MappedFile();
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        /*!
+         * \brief Maps a file. The file previously mapped, if any, is closed.
+         * \param path The path of the file.
+         * \returns `false` if the file can't be opened or mapped.
+         */
+        bool open(const std::string &path);
+
+        /*!
+         * \brief Unmaps the file.
+         */
+        void close();
+
+        bool isOpen() const {
+            return data != nullptr;
+        }
+
+        /*!
+         * \brief Returns the content of the file.
+         */
+        const char *getData() const {
+            return data;
+        }
+
+        std::size_t getSize() const {
+            return size;
+        }
+
+      private:
+        const char *data = nullptr;
+        std::size_t size = 0;
+#ifdef _WIN32
+        void *fileHandle = nullptr;
+        void *mappingHandle = nullptr;
+#endif
+    };
+
+} // namespace Utils
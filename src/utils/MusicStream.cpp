@@ -0,0 +1,142 @@
+/*
+MusicStream.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "MusicStream.hpp"
+
+#include <algorithm>
+
+namespace Utils {
+
+    MusicStream::~MusicStream() {
+        //The streaming thread must not read the members while they are destroyed
+        stop();
+    }
+
+    bool MusicStream::openFromFile(const std::string &path) {
+        return file.openFromFile(path) && preload();
+    }
+
+    bool MusicStream::openFromMemory(const void *data, std::size_t size) {
+        return file.openFromMemory(data, size) && preload();
+    }
+
+    bool MusicStream::preload() {
+        initialize(file.getChannelCount(), file.getSampleRate());
+        head.resize(std::min<sf::Uint64>(file.getSampleCount(), (sf::Uint64)file.getSampleRate() * file.getChannelCount() * MUSIC_PRELOAD_DURATION));
+        head.resize(file.read(head.data(), head.size()));
+        position = 0;
+        return true;
+    }
+
+    void MusicStream::setLooping(bool looping) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->looping = looping;
+    }
+
+    void MusicStream::setGain(float gain) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->gain = gain;
+        target = gain;
+        step = 0;
+        stopAfterFade = false;
+        fadedOut = false;
+    }
+
+    void MusicStream::fade(float target, sf::Time duration, bool stopAfter) {
+        std::lock_guard<std::mutex> lock(mutex);
+        float frames = duration.asSeconds() * getSampleRate();
+        this->target = target;
+        if(frames >= 1) {
+            step = (target - gain) / frames;
+        } else {
+            gain = target;
+            step = 0;
+        }
+        stopAfterFade = stopAfter;
+        fadedOut = false;
+    }
+
+    bool MusicStream::isFadedOut() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return fadedOut;
+    }
+
+    bool MusicStream::onGetData(Chunk &data) {
+        std::size_t channels = getChannelCount();
+        std::size_t chunkSize = std::max<std::size_t>(1, getSampleRate() * MUSIC_CHUNK_DURATION / 1000) * channels;
+        buffer.resize(chunkSize);
+        bool loop;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            loop = looping;
+        }
+
+        //Reads the preloaded samples, then the file
+        std::size_t count = 0;
+        while(count < chunkSize) {
+            std::size_t read;
+            if(position < head.size()) {
+                read = std::min<std::size_t>(chunkSize - count, head.size() - position);
+                std::copy_n(head.data() + position, read, buffer.data() + count);
+            } else {
+                if(seekFile) {
+                    file.seek((sf::Uint64)head.size());
+                    seekFile = false;
+                }
+                read = file.read(buffer.data() + count, chunkSize - count);
+            }
+            if(read == 0) {
+                //The end of the music : the chunk continues with the beginning when looping
+                if(!loop || position == 0) {
+                    break;
+                }
+                onSeek(sf::Time::Zero);
+                continue;
+            }
+            position += read;
+            count += read;
+        }
+        bool end = count < chunkSize;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(gain != 1 || target != 1) {
+                for(std::size_t frame = 0; frame < count; frame += channels) {
+                    if(gain <= 0 && stopAfterFade) {
+                        count = frame;
+                        end = true;
+                        fadedOut = true;
+                        break;
+                    }
+                    for(std::size_t i = frame; i < frame + channels; i++) {
+                        buffer[i] = (sf::Int16)(buffer[i] * gain);
+                    }
+                    if(gain != target) {
+                        gain += step;
+                        if((step > 0 && gain > target) || (step < 0 && gain < target)) {
+                            gain = target;
+                        }
+                    }
+                }
+            }
+        }
+
+        data.samples = buffer.data();
+        data.sampleCount = count;
+        return !end;
+    }
+
+    void MusicStream::onSeek(sf::Time timeOffset) {
+        position = (sf::Uint64)timeOffset.asMicroseconds() * getSampleRate() / 1000000 * getChannelCount();
+        //Rewinding doesn't touch the file until the preloaded samples are played, so a music can be restarted without reading it
+        if(position < head.size()) {
+            seekFile = true;
+        } else {
+            file.seek(position);
+            seekFile = false;
+        }
+    }
+
+} // namespace Utils
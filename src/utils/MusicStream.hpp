@@ -0,0 +1,116 @@
+/*!
+ * \file MusicStream.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/SoundStream.hpp>
+#include <SFML/System/Time.hpp>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief The duration decoded when a music is opened, in seconds.
+ */
+#define MUSIC_PRELOAD_DURATION 3
+/*!
+ * \brief The duration of the chunks given to the audio device, in milliseconds. A fade starts at most three chunks after being requested.
+ */
+#define MUSIC_CHUNK_DURATION 100
+
+namespace Utils {
+
+    /*!
+     * \brief A music streamed from a file, which can fade in and fade out.
+     * \details Unlike sf::Music, the beginning of the music is decoded when it is opened, so the stream can be opened on another
+     * thread and played without reading the file. The rest of the file is decoded by the streaming thread of SFML.
+     *
+     * The fades are applied to the samples given to the audio device, so two streams can be crossfaded without updating their volume
+     * every frame. The volume of the stream (sf::SoundSource::setVolume) is applied on top of the fade.
+     */
+    class MusicStream : public sf::SoundStream {
+      public:
+        MusicStream() = default;
+        ~MusicStream() override;
+
+        /*!
+         * \brief Opens a music file and decodes its beginning.
+         * \returns `false` if the file can't be opened.
+         */
+        bool openFromFile(const std::string &path);
+        /*!
+         * \brief Opens a music from a file in memory and decodes its beginning.
+         * \details The data must stay valid as long as the stream is used.
+         * \returns `false` if the data can't be read.
+         */
+        bool openFromMemory(const void *data, std::size_t size);
+
+        /*!
+         * \brief Sets if the music loops.
+         * \details The stream loops by itself, without gap, instead of using sf::SoundStream::setLoop.
+         */
+        void setLooping(bool looping);
+
+        /*!
+         * \brief Sets the fade level immediately, between 0 (silent) and 1.
+         */
+        void setGain(float gain);
+        /*!
+         * \brief Fades from the current fade level to the given one.
+         * \param target The fade level at the end of the fade, between 0 and 1.
+         * \param duration The duration of the fade.
+         * \param stopAfter If `true`, the stream stops when the fade level reaches 0.
+         */
+        void fade(float target, sf::Time duration, bool stopAfter);
+        /*!
+         * \returns `true` if the stream has faded out and is stopping, or has stopped.
+         */
+        bool isFadedOut() const;
+
+      protected:
+        bool onGetData(Chunk &data) override;
+        void onSeek(sf::Time timeOffset) override;
+
+      private:
+        /*!
+         * \brief Decodes the beginning of the music once the file is open.
+         */
+        bool preload();
+
+        sf::InputSoundFile file;
+        /*!
+         * \brief The samples decoded when opening the file. The file is read from the end of these samples.
+         */
+        std::vector<sf::Int16> head;
+        /*!
+         * \brief The samples of the chunk being played.
+         */
+        std::vector<sf::Int16> buffer;
+        /*!
+         * \brief The position in the music, in samples.
+         */
+        sf::Uint64 position = 0;
+        /*!
+         * \brief If `true`, the file must be moved to the end of the preloaded samples before being read.
+         */
+        bool seekFile = false;
+
+        /*!
+         * \brief Protects the loop and fade settings, which are read by the streaming thread.
+         */
+        mutable std::mutex mutex;
+        bool looping = false;
+        float gain = 1;
+        float target = 1;
+        /*!
+         * \brief The change of the fade level at each sample frame.
+         */
+        float step = 0;
+        bool stopAfterFade = false;
+        bool fadedOut = false;
+    };
+
+} // namespace Utils
@@ -16,7 +16,10 @@ namespace Utils {
 
     OpString::OpString(StringKeys &instance, std::string const &key, std::vector<sf::String *> obj) {
         this->key = key;
-        unsigned int instances = (key == "void") ? 0 : StringKeys::countInstances(instance.get(key), '~');
+        if(!key.empty() && key != "void") {
+            keyId = StringKeys::getId(key);
+        }
+        unsigned int instances = (key == "void") ? 0 : StringKeys::countInstances(instance.get(keyId), '~');
         this->objects = obj;
 
         if(objects.size() != instances) {
@@ -47,10 +50,10 @@ namespace Utils {
             return sf::String();
         }
         if(objects.size() == 0) { //If there is not object, it just returns the string.
-            return instance.get(key);
+            return instance.get(keyId);
         }
         //Ok, so there is some things to do
-        std::vector<sf::String> splitted = StringKeys::split(instance.get(key), '~'); //Split every ~
+        std::vector<sf::String> splitted = StringKeys::split(instance.get(keyId), '~'); //Split every ~
 
         sf::String toReturn;
         for(size_t i = 0; i < splitted.size(); ++i) {
@@ -32,6 +32,10 @@ namespace Utils {
          * \brief The StringKey key to get the string.
          */
         std::string key;
+        /*!
+         * \brief The identifier of the key, computed once to get the string without searching the key.
+         */
+        KeyId keyId = KeyId::NONE;
         /*!
          * \brief The vector of objects to insert in the string.
          * \details It's a pointer because it allows the value to change after the initialisation of the object.
@@ -0,0 +1,192 @@
+/*
+ResourceArchive.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "ResourceArchive.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <vector>
+
+#include "binaryfile.hpp"
+#include "exceptions.hpp"
+#include "log.hpp"
+
+#define RESOURCE_ARCHIVE_MAGIC "OPRA"
+#define RESOURCE_ARCHIVE_VERSION 1
+//Size of an entry of the index
+#define RESOURCE_ARCHIVE_ENTRY_SIZE 16
+//Alignment of the content of the files
+#define RESOURCE_ARCHIVE_ALIGNMENT 8
+
+namespace {
+    using Utils::BinaryFile::writeInt;
+
+    std::uint64_t align(std::uint64_t offset) {
+        return (offset + RESOURCE_ARCHIVE_ALIGNMENT - 1) / RESOURCE_ARCHIVE_ALIGNMENT * RESOURCE_ARCHIVE_ALIGNMENT;
+    }
+
+    struct PackedFile {
+        std::string path;
+        std::uint64_t size;
+        std::filesystem::file_time_type time;
+    };
+
+    //Lists the files of the folder to pack, sorted by path
+    std::vector<PackedFile> listFiles(const std::string &folderPath, const std::string &archivePath, const std::vector<std::string> &excluded) {
+        std::vector<PackedFile> files;
+        try {
+            for(const auto &entry : std::filesystem::recursive_directory_iterator(folderPath)) {
+                std::error_code error;
+                if(!entry.is_regular_file() || std::filesystem::equivalent(entry.path(), archivePath, error)) {
+                    continue;
+                }
+                std::string path = std::filesystem::relative(entry.path(), folderPath).generic_string();
+                if(std::find(excluded.begin(), excluded.end(), path) == excluded.end()) {
+                    files.push_back({path, entry.file_size(), entry.last_write_time()});
+                }
+            }
+        } catch(std::filesystem::filesystem_error &e) {
+            throw Utils::LoadingException(e.path1().string(), true);
+        }
+        std::sort(files.begin(), files.end(), [](PackedFile const &a, PackedFile const &b) { return a.path < b.path; });
+        return files;
+    }
+} // namespace
+
+namespace Utils {
+
+    bool ResourceArchive::open(const std::string &path) {
+        count = 0;
+        if(!file.open(path)) {
+            return false;
+        }
+
+        std::optional<std::uint32_t> filesCount = BinaryFile::readHeader(file, path, RESOURCE_ARCHIVE_MAGIC, RESOURCE_ARCHIVE_VERSION, RESOURCE_ARCHIVE_ENTRY_SIZE, "resource archive");
+        if(!filesCount) {
+            file.close();
+            return false;
+        }
+
+        //The binary search needs valid and sorted entries
+        count = *filesCount;
+        for(std::uint32_t i = 0; i < count; i++) {
+            IndexEntry entry = getEntry(i);
+            if(!BinaryFile::contains(file, entry.pathOffset, entry.pathLength) || !BinaryFile::contains(file, entry.dataOffset, entry.dataSize)
+               || (i > 0 && getPath(getEntry(i - 1)) >= getPath(entry))) {
+                Log::warn(path + " has an invalid index.");
+                count = 0;
+                file.close();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ResourceArchive::IndexEntry ResourceArchive::getEntry(std::size_t position) const {
+        IndexEntry entry;
+        std::memcpy(&entry, file.getData() + BINARY_FILE_HEADER_SIZE + position * RESOURCE_ARCHIVE_ENTRY_SIZE, RESOURCE_ARCHIVE_ENTRY_SIZE);
+        return entry;
+    }
+
+    std::optional<std::span<const char>> ResourceArchive::find(std::string_view path) const {
+        std::size_t first = 0;
+        std::size_t last = count;
+        while(first < last) {
+            std::size_t middle = first + (last - first) / 2;
+            IndexEntry entry = getEntry(middle);
+            int comparison = getPath(entry).compare(path);
+            if(comparison == 0) {
+                return std::span<const char>(file.getData() + entry.dataOffset, entry.dataSize);
+            } else if(comparison < 0) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool ResourceArchive::isUpToDate(const std::string &folderPath, const std::string &archivePath, const std::vector<std::string> &excluded) {
+        std::error_code error;
+        std::filesystem::file_time_type archiveTime = std::filesystem::last_write_time(archivePath, error);
+        ResourceArchive archive;
+        if(error || !archive.open(archivePath)) {
+            return false;
+        }
+        std::vector<PackedFile> files;
+        try {
+            files = listFiles(folderPath, archivePath, excluded);
+        } catch(LoadingException &e) {
+            Log::warn("Unable to check " + archivePath + ": " + e.desc());
+            return false;
+        }
+        if(files.size() != archive.count) {
+            return false;
+        }
+        //Both lists are sorted by path
+        for(std::size_t i = 0; i < files.size(); i++) {
+            IndexEntry entry = archive.getEntry(i);
+            if(archive.getPath(entry) != files[i].path || entry.dataSize != files[i].size || files[i].time > archiveTime) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ResourceArchive::pack(const std::string &folderPath, const std::string &archivePath, const std::vector<std::string> &excluded) {
+        std::vector<PackedFile> files = listFiles(folderPath, archivePath, excluded);
+
+        std::string buffer;
+        BinaryFile::writeHeader(buffer, RESOURCE_ARCHIVE_MAGIC, RESOURCE_ARCHIVE_VERSION, files.size());
+
+        //The paths follow the index, and the contents follow the paths
+        std::uint64_t pathOffset = BINARY_FILE_HEADER_SIZE + files.size() * RESOURCE_ARCHIVE_ENTRY_SIZE;
+        std::uint64_t dataOffset = pathOffset;
+        for(const PackedFile &packed : files) {
+            dataOffset += packed.path.size();
+        }
+        std::vector<std::uint64_t> dataOffsets;
+        for(const PackedFile &packed : files) {
+            dataOffset = align(dataOffset);
+            dataOffsets.push_back(dataOffset);
+            dataOffset += packed.size;
+        }
+        if(dataOffset > UINT32_MAX) {
+            throw UnexpectedValueException(archivePath, "an archive smaller than 4 GB", true);
+        }
+
+        for(std::size_t i = 0; i < files.size(); i++) {
+            writeInt(buffer, pathOffset, 4);
+            writeInt(buffer, files[i].path.size(), 4);
+            writeInt(buffer, dataOffsets[i], 4);
+            writeInt(buffer, files[i].size, 4);
+            pathOffset += files[i].path.size();
+        }
+        for(const PackedFile &packed : files) {
+            buffer += packed.path;
+        }
+
+        std::ofstream archive(archivePath, std::ios::binary);
+        if(!archive || !archive.write(buffer.data(), buffer.size())) {
+            throw LoadingException(archivePath, true);
+        }
+        for(std::size_t i = 0; i < files.size(); i++) {
+            std::string content(dataOffsets[i] - (std::uint64_t)archive.tellp(), '\0');
+            std::ifstream input(std::filesystem::path(folderPath) / files[i].path, std::ios::binary);
+            content.resize(content.size() + files[i].size);
+            if(!input || !input.read(content.data() + content.size() - files[i].size, files[i].size)) {
+                throw LoadingException(files[i].path, true);
+            }
+            if(!archive.write(content.data(), content.size())) {
+                throw LoadingException(archivePath, true);
+            }
+        }
+        Log::oplog("Packed " + std::to_string(files.size()) + " files in " + archivePath);
+    }
+
+} // namespace Utils
@@ -0,0 +1,92 @@
+/*!
+ * \file ResourceArchive.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MappedFile.hpp"
+
+namespace Utils {
+
+    /*!
+     * \brief An archive containing the files of the resource folder, read from a memory mapped file.
+     * \details The archive is written by ResourceArchive::pack (see the `--pack-resources` option). Opening it only checks its index :
+     * a file is found by a binary search in the index, and its content is read directly from the mapping.
+     *
+     * All the values are little-endian. The file contains :
+     * - A header (see Utils::BinaryFile) : the magic number `OPRA`, the version, the byte order mark and the number of files.
+     * - The index, sorted by path : for each file, the offset and the length of its path, and the offset and the size of its content (4 bytes each).
+     * - The paths, relative to the resource folder and using `/` as separator, then the contents of the files, each one aligned on 8 bytes.
+     */
+    class ResourceArchive {
+      public:
+        /*!
+         * \brief Opens an archive and checks its index.
+         * \returns `false` if the file can't be opened or isn't a valid archive.
+         */
+        bool open(const std::string &path);
+
+        bool isOpen() const {
+            return file.isOpen();
+        }
+
+        std::size_t getFilesCount() const {
+            return count;
+        }
+
+        /*!
+         * \brief Returns the content of a file of the archive.
+         * \param path The path of the file, relative to the resource folder.
+         * \returns The content, valid as long as the archive is open, or nothing if the archive doesn't contain the file.
+         */
+        std::optional<std::span<const char>> find(std::string_view path) const;
+
+        /*!
+         * \brief Writes the files of a folder in an archive.
+         * \param folderPath The path of the folder (usually the resource folder).
+         * \param archivePath The path of the archive to write. If it is in the folder, it isn't put in itself.
+         * \param excluded The paths of the files which mustn't be packed, relative to the folder and using `/` as separator.
+         * \throws Utils::LoadingException If a file can't be read or written.
+         * \throws Utils::UnexpectedValueException If the archive would be larger than 4 GB.
+         */
+        static void pack(const std::string &folderPath, const std::string &archivePath, const std::vector<std::string> &excluded = {});
+
+        /*!
+         * \brief Checks if an archive contains the current files of a folder.
+         * \details The whole folder is listed : an archive is out of date if a file has been added, removed or resized since it has been
+         * packed, or if a file is more recent than the archive. Since every file is checked, this is only done on request (see the `--check-resources` option).
+         * \param folderPath The path of the packed folder.
+         * \param archivePath The path of the archive.
+         * \param excluded The files which aren't packed, as given to pack().
+         * \returns `false` if the archive is out of date, or if the archive or the folder can't be read.
+         */
+        static bool isUpToDate(const std::string &folderPath, const std::string &archivePath, const std::vector<std::string> &excluded = {});
+
+      private:
+        struct IndexEntry {
+            std::uint32_t pathOffset;
+            std::uint32_t pathLength;
+            std::uint32_t dataOffset;
+            std::uint32_t dataSize;
+        };
+
+        IndexEntry getEntry(std::size_t position) const;
+
+        std::string_view getPath(const IndexEntry &entry) const {
+            return std::string_view(file.getData() + entry.pathOffset, entry.pathLength);
+        }
+
+        MappedFile file;
+        std::uint32_t count = 0;
+    };
+
+} // namespace Utils
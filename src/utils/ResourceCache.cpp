@@ -0,0 +1,159 @@
+/*
+ResourceCache.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "ResourceCache.hpp"
+
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include "ResourceLoader.hpp"
+#include "log.hpp"
+#include "mainthread.hpp"
+#include "threadpool.hpp"
+
+namespace {
+    std::size_t memorySize(const sf::Texture &texture, const std::string & /*path*/) {
+        return (std::size_t)texture.getSize().x * texture.getSize().y * 4;
+    }
+
+    std::size_t memorySize(const sf::SoundBuffer &buffer, const std::string & /*path*/) {
+        return buffer.getSampleCount() * sizeof(sf::Int16);
+    }
+
+    //The glyphs are rendered when needed, so only the file, kept in memory by FreeType, is counted
+    std::size_t memorySize(const sf::Font & /*font*/, const std::string &path) {
+        if(std::optional<std::span<const char>> file = Utils::ResourceLoader::findFile(path)) {
+            return file->size();
+        }
+        std::error_code error;
+        std::uintmax_t size = std::filesystem::file_size(Utils::ResourceLoader::getResourcePath() + path, error);
+        return error ? 0 : size;
+    }
+
+    //The textures (and the glyphs of the fonts) are destroyed on the main thread, like in TextureAtlas::release, since the last handle can be dropped by any thread
+    template <typename T>
+    std::shared_ptr<T> makeResource() {
+        if constexpr(std::is_same_v<T, sf::SoundBuffer>) {
+            return std::make_shared<T>();
+        } else {
+            return std::shared_ptr<T>(new T(), [](T *resource) { Utils::MainThread::run([resource]() { delete resource; }); });
+        }
+    }
+} // namespace
+
+namespace Utils {
+
+    template <typename T>
+    struct ResourceCache::Cache {
+        struct Resource {
+            std::weak_ptr<const T> handle;
+            std::size_t memory;
+        };
+        std::mutex mutex;
+        std::map<std::string, Resource> resources;
+    };
+
+    template <typename T>
+    ResourceCache::Cache<T> &ResourceCache::getCache() {
+        static Cache<T> cache;
+        return cache;
+    }
+
+    template <typename T>
+    std::shared_ptr<const T> ResourceCache::get(const std::string &path, bool fatal) {
+        Cache<T> &cache = getCache<T>();
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            auto itor = cache.resources.find(path);
+            if(itor != cache.resources.end()) {
+                if(std::shared_ptr<const T> resource = itor->second.handle.lock()) {
+                    return resource;
+                }
+            }
+        }
+
+        //Loaded without the lock, since loading a texture in another thread waits for the main thread
+        std::shared_ptr<T> resource = makeResource<T>();
+        ResourceLoader::load(*resource, path.c_str(), fatal);
+        std::size_t memory = memorySize(*resource, path);
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        std::erase_if(cache.resources, [](auto const &entry) { return entry.second.handle.expired(); });
+        //Another thread may have loaded the same resource in the meantime
+        auto itor = cache.resources.find(path);
+        if(itor != cache.resources.end()) {
+            if(std::shared_ptr<const T> loaded = itor->second.handle.lock()) {
+                return loaded;
+            }
+        }
+        cache.resources[path] = {resource, memory};
+        return resource;
+    }
+
+    template <typename T>
+    void ResourceCache::addEntries(std::vector<Entry> &entries) {
+        Cache<T> &cache = getCache<T>();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        for(auto const &resource : cache.resources) {
+            long users = resource.second.handle.use_count();
+            if(users > 0) {
+                entries.push_back({resource.first, resource.second.memory, users});
+            }
+        }
+    }
+
+    std::shared_ptr<const sf::Texture> ResourceCache::getTexture(const std::string &path, bool fatal) {
+        return get<sf::Texture>(path, fatal);
+    }
+
+    std::shared_ptr<const sf::SoundBuffer> ResourceCache::getSoundBuffer(const std::string &path, bool fatal) {
+        return get<sf::SoundBuffer>(path, fatal);
+    }
+
+    std::shared_ptr<const sf::Font> ResourceCache::getFont(const std::string &path, bool fatal) {
+        return get<sf::Font>(path, fatal);
+    }
+
+    std::future<std::shared_ptr<const sf::Texture>> ResourceCache::loadTexture(const std::string &path, bool fatal) {
+        return ThreadPool::submit([path, fatal]() { return get<sf::Texture>(path, fatal); });
+    }
+
+    std::future<std::shared_ptr<const sf::SoundBuffer>> ResourceCache::loadSoundBuffer(const std::string &path, bool fatal) {
+        return ThreadPool::submit([path, fatal]() { return get<sf::SoundBuffer>(path, fatal); });
+    }
+
+    std::vector<ResourceCache::Entry> ResourceCache::getEntries() {
+        std::vector<Entry> entries;
+        addEntries<sf::Texture>(entries);
+        addEntries<sf::SoundBuffer>(entries);
+        addEntries<sf::Font>(entries);
+        return entries;
+    }
+
+    std::size_t ResourceCache::getMemorySize() {
+        std::size_t memory = 0;
+        for(Entry const &entry : getEntries()) {
+            memory += entry.memory;
+        }
+        return memory;
+    }
+
+    void ResourceCache::logMemory() {
+        std::size_t memory = 0;
+        for(Entry const &entry : getEntries()) {
+            Log::oplog(entry.path + " : " + std::to_string(entry.memory / 1024) + " KB, " + std::to_string(entry.users) + " user(s)");
+            memory += entry.memory;
+        }
+        Log::oplog("Resources in memory : " + std::to_string(memory / 1024) + " KB");
+    }
+
+} // namespace Utils
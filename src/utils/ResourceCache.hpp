@@ -0,0 +1,98 @@
+/*!
+ * \file ResourceCache.hpp
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sf {
+    class Font;
+    class SoundBuffer;
+    class Texture;
+}  // namespace sf
+
+namespace Utils {
+
+    /*!
+     * \brief Shares the resources loaded from the resource folder.
+     * \details A resource is loaded the first time it is requested, and the same resource is then given to every caller requesting the same path.
+     * It is freed when the last handle to it is destroyed. The methods can be called from any thread (see ResourceLoader::load).
+     * The textures and the fonts are always freed on the main thread (see Utils::MainThread), whichever thread destroys the last handle.
+     */
+    class ResourceCache {
+      public:
+        /*!
+         * \brief A resource currently loaded, returned by ResourceCache::getEntries.
+         */
+        struct Entry {
+            std::string path;
+            /*!
+             * \brief An estimation of the memory used by the resource, in bytes.
+             */
+            std::size_t memory;
+            /*!
+             * \brief The number of handles to the resource.
+             */
+            long users;
+        };
+
+        /*!
+         * \brief Returns the texture at the given path, and loads it if it isn't loaded yet.
+         * \param path The path of the texture, relative to the resource folder.
+         * \param fatal If `true`, a LoadingException is thrown if the texture can't be loaded. Otherwise, an empty texture is returned.
+         */
+        static std::shared_ptr<const sf::Texture> getTexture(const std::string &path, bool fatal = false);
+        /*!
+         * \copydoc getTexture
+         */
+        static std::shared_ptr<const sf::SoundBuffer> getSoundBuffer(const std::string &path, bool fatal = false);
+        /*!
+         * \copydoc getTexture
+         */
+        static std::shared_ptr<const sf::Font> getFont(const std::string &path, bool fatal = false);
+
+        /*!
+         * \brief Returns the texture at the given path, loaded on the thread pool (see Utils::ThreadPool).
+         * \details Used to load many resources in parallel : the loads are started first, and the results are then waited with Utils::ThreadPool::wait.
+         * \copydetails getTexture
+         */
+        static std::future<std::shared_ptr<const sf::Texture>> loadTexture(const std::string &path, bool fatal = false);
+        /*!
+         * \copydoc loadTexture
+         */
+        static std::future<std::shared_ptr<const sf::SoundBuffer>> loadSoundBuffer(const std::string &path, bool fatal = false);
+
+        /*!
+         * \brief Returns the resources currently loaded.
+         */
+        static std::vector<Entry> getEntries();
+        /*!
+         * \brief Returns an estimation of the memory used by the loaded resources, in bytes.
+         */
+        static std::size_t getMemorySize();
+        /*!
+         * \brief Writes the loaded resources and their memory in the log.
+         */
+        static void logMemory();
+
+      private:
+        template <typename T>
+        struct Cache;
+
+        template <typename T>
+        static Cache<T> &getCache();
+
+        template <typename T>
+        static std::shared_ptr<const T> get(const std::string &path, bool fatal);
+
+        template <typename T>
+        static void addEntries(std::vector<Entry> &entries);
+    };
+
+} // namespace Utils
@@ -6,14 +6,19 @@
 #include "ResourceLoader.hpp"
 
 #include <cstdio>
-#include <SFML/Audio/Music.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <algorithm>
+#include <sstream>
+
+#include "mainthread.hpp"
+#include "threadpool.hpp"
 
 namespace Utils {
 
     std::string ResourceLoader::resourcePath = "";
 
+    ResourceArchive ResourceLoader::archive;
+
     std::string ResourceLoader::getResourcePath(){
         return resourcePath;
     }
@@ -26,33 +31,125 @@ namespace Utils {
         return !getResourcePath().empty();
     }
 
-    void ResourceLoader::loadTextureArray(sf::Texture container[], const char *path, size_t nb_frame, size_t path_offset) {
-        for(size_t i = 0; i < nb_frame; ++i) {
-            char buffer[2048];
+    bool ResourceLoader::openArchive(const std::string &path) {
+        return archive.open(path);
+    }
 
-            container[i] = sf::Texture();
-            snprintf(buffer, 2048, path, i + path_offset);
-            ResourceLoader::load(container[i], buffer);
+    std::optional<std::span<const char>> ResourceLoader::findFile(const std::string &path) {
+        return archive.find(path);
+    }
+
+    std::unique_ptr<std::istream> ResourceLoader::openFile(const std::string &path) {
+        if(std::optional<std::span<const char>> file = findFile(path)) {
+            return std::make_unique<std::istringstream>(std::string(file->data(), file->size()));
+        }
+        auto stream = std::make_unique<std::ifstream>(ResourceLoader::getResourcePath() + path);
+        if(!*stream) {
+            return nullptr;
+        }
+        return stream;
+    }
+
+    void ResourceLoader::load(sf::Texture &resource, const char *path, bool fatal) {
+        if(MainThread::isMainThread()) {
+            load<sf::Texture>(resource, path, fatal);
+            return;
+        }
+        try {
+            sf::Image image;
+            if(!loadFile(image, path)) {
+                throw LoadingException(path, fatal);
+            }
+            MainThread::run([&resource, &image, path, fatal]() {
+                if(!resource.loadFromImage(image)) {
+                    throw LoadingException(path, fatal);
+                }
+            });
+        } catch(LoadingException &e) {
+            if(e.fatal) throw;
+            else Log::warn(e.desc());
+        }
+    }
+
+    std::future<sf::Image> ResourceLoader::loadImage(const std::string &path, bool fatal) {
+        return ThreadPool::submit([path, fatal]() {
+            sf::Image image;
+            try {
+                if(!loadFile(image, path)) {
+                    throw LoadingException(path, fatal);
+                }
+            } catch(LoadingException &e) {
+                if(e.fatal) throw;
+                else Log::warn(e.desc());
+            }
+            return image;
+        });
+    }
+
+    void ResourceLoader::upload(sf::Texture &resource, const sf::Image &image) {
+        if(image.getSize().x == 0 || image.getSize().y == 0) {
+            return;
         }
+        MainThread::run([&resource, &image]() { resource.loadFromImage(image); });
+    }
+
+    void ResourceLoader::loadTextureArray(sf::Texture container[], const char *path, size_t nb_frame, size_t path_offset) {
+        TextureBatch batch;
+        batch.addArray(container, path, nb_frame, path_offset);
+        batch.wait();
     }
 
     void ResourceLoader::loadTextureArray(std::vector<sf::Texture> &container, const char *path, size_t nb_frame, size_t path_offset) {
+        TextureBatch batch;
+        batch.addArray(container, path, nb_frame, path_offset);
+        batch.wait();
+    }
+
+    std::unique_ptr<MusicStream> ResourceLoader::loadMusic(const char *path) {
+        auto music = std::make_unique<MusicStream>();
+        //The music is streamed from the archive while it is played
+        std::optional<std::span<const char>> file = findFile(path);
+        if(file ? !music->openFromMemory(file->data(), file->size()) : !music->openFromFile(ResourceLoader::getResourcePath() + path)) {
+            throw LoadingException(path);
+        }
+        return music;
+    }
+
+    void TextureBatch::add(sf::Texture &texture, const std::string &path, bool fatal) {
+        pending.emplace_back(&texture, ResourceLoader::loadImage(path, fatal));
+    }
+
+    void TextureBatch::addArray(sf::Texture container[], const char *path, size_t nb_frame, size_t path_offset) {
         for(size_t i = 0; i < nb_frame; ++i) {
             char buffer[2048];
 
-            container.emplace_back();
             snprintf(buffer, 2048, path, i + path_offset);
-            ResourceLoader::load(container[i], buffer);
+            container[i] = sf::Texture();
+            add(container[i], buffer);
         }
     }
 
-    std::unique_ptr<sf::Music> ResourceLoader::loadMusic(const char *path) {
-        auto music = std::make_unique<sf::Music>();
-        if(!music->openFromFile(ResourceLoader::getResourcePath() + path)) {
-            throw LoadingException(path);
-        }
-        return music;
+    void TextureBatch::addArray(std::vector<sf::Texture> &container, const char *path, size_t nb_frame, size_t path_offset) {
+        container.resize(nb_frame);
+        addArray(container.data(), path, nb_frame, path_offset);
     }
 
+    void TextureBatch::wait() {
+        std::vector<std::pair<sf::Texture *, std::future<sf::Image>>> textures = std::move(pending);
+        pending.clear();
+        std::vector<sf::Image> images;
+        images.reserve(textures.size());
+        for(auto &texture : textures) {
+            images.push_back(ThreadPool::wait(texture.second));
+        }
+        //A single task, so a loading thread waits for the main thread only once
+        MainThread::run([&textures, &images]() {
+            for(size_t i = 0; i < textures.size(); ++i) {
+                if(images[i].getSize().x != 0 && images[i].getSize().y != 0) {
+                    textures[i].first->loadFromImage(images[i]);
+                }
+            }
+        });
+    }
 
 } // namespace Utils
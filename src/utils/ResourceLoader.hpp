@@ -9,14 +9,21 @@
 #include <SFML/Graphics.hpp>
 #include <cstddef>
 #include <fstream>
+#include <future>
+#include <istream>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "MusicStream.hpp"
+#include "ResourceArchive.hpp"
 #include "exceptions.hpp"
 #include "log.hpp"
 
 namespace sf {
-    class Music;
     class Texture;
 }  // namespace sf
 
@@ -34,10 +41,42 @@ namespace Utils {
          */
         static bool checkResourceFolderExists();
 
+        /*!
+         * \brief Opens the archive from which the resources are read (see ResourceArchive).
+         * \details The files which aren't in the archive are still read from the resource folder. The archive must be opened before the
+         * resources are loaded, and stays open until the end of the program, since some resources (like the fonts and the musics) are read from it while they are used.
+         * \returns `false` if the archive can't be opened.
+         */
+        static bool openArchive(const std::string &path);
+
+        /*!
+         * \brief Returns the content of a file of the resource archive.
+         * \param path - path of the file, relative to the resource folder.
+         * \returns The content, or nothing if the archive isn't open or doesn't contain the file.
+         */
+        static std::optional<std::span<const char>> findFile(const std::string &path);
+
+        /*!
+         * \brief Opens a file of the resource archive, or of the resource folder if the archive doesn't contain it.
+         * \param path - path of the file, relative to the resource folder.
+         * \returns The stream, or `nullptr` if the file can't be opened.
+         */
+        static std::unique_ptr<std::istream> openFile(const std::string &path);
+
+        /*!
+         * \brief Loads an SFML resource from the resource archive, or from the resource folder if the archive doesn't contain it.
+         * \details Unlike load(), nothing is reported if the resource can't be loaded.
+         *
+         * \tparam T - the methods T::loadFromMemory() and T::loadFromFile() must exist.
+         * \returns `true` if the resource has been loaded.
+         */
+        template <typename T>
+        static bool loadFile(T &resource, const std::string &path);
+
         /*!
          * \brief Loads an arbitrary SFML resource
          *
-         * \tparam T - the method T::loadFromFile() must exists.
+         * \tparam T - the methods T::loadFromMemory() and T::loadFromFile() must exist.
          * \param resource - the resource to load
          * \param path - path of the resource, relative to the resource folder.
          * \param fatal - if true, the program quit if there is an error.
@@ -45,8 +84,34 @@ namespace Utils {
         template <typename T>
         static void load(T &resource, const char *path, bool fatal = false);
 
+        /*!
+         * \brief Loads a texture.
+         * \details Can be called from any thread : the image is decoded in the calling thread, and the texture is then uploaded on the main thread (see Utils::MainThread).
+         *
+         * \param resource - the texture to load
+         * \param path - path of the texture, relative to the resource folder.
+         * \param fatal - if true, the program quit if there is an error.
+         */
+        static void load(sf::Texture &resource, const char *path, bool fatal = false);
+
+        /*!
+         * \brief Decodes an image on the thread pool (see Utils::ThreadPool).
+         *
+         * \param path - path of the image, relative to the resource folder.
+         * \param fatal - if true, the future throws a LoadingException if there is an error. Otherwise, the image is empty.
+         */
+        static std::future<sf::Image> loadImage(const std::string &path, bool fatal = false);
+
+        /*!
+         * \brief Uploads a decoded image in a texture, on the main thread (see Utils::MainThread).
+         * \details Nothing is done if the image is empty, since the error has already been reported by loadImage.
+         */
+        static void upload(sf::Texture &resource, const sf::Image &image);
+
         /*!
          * \brief Loads an array of textures (multiple frames of the same animation).
+         * \details The frames are decoded in parallel on the thread pool, and this function waits until they are uploaded.
+         * To load several arrays in parallel, use a TextureBatch instead.
          *
          * \param container
          * \param path - path relative to the resource folder. It must contains a "%d" , which will be replaced by the
@@ -65,20 +130,68 @@ namespace Utils {
         static void loadTextureArray(std::vector<sf::Texture> &container, const char *path, size_t nb_frame, size_t path_offset = 0);
 
         /*!
-         * \brief Loads a music.
+         * \brief Opens a music and decodes its beginning (see MusicStream).
          * \param path The path to the music file.
+         * \throws Utils::LoadingException If the music can't be opened.
          */
-        static std::unique_ptr<sf::Music> loadMusic(const char *path);
+        static std::unique_ptr<MusicStream> loadMusic(const char *path);
 
     private:
         static std::string resourcePath;
 
+        static ResourceArchive archive;
+
     };
 
+    /*!
+     * \brief Loads several textures in parallel.
+     * \details The images are decoded on the thread pool as soon as they are added, and the textures are uploaded by wait(),
+     * so all the textures of a screen can be loaded at the same time. The textures must stay valid until wait() returns.
+     */
+    class TextureBatch {
+      public:
+        /*!
+         * \brief Starts loading a texture.
+         * \param texture - the texture to load
+         * \param path - path of the texture, relative to the resource folder.
+         * \param fatal - if true, wait() throws a LoadingException if there is an error.
+         */
+        void add(sf::Texture &texture, const std::string &path, bool fatal = false);
+
+        /*!
+         * \brief Starts loading an array of textures.
+         * \copydetails ResourceLoader::loadTextureArray(sf::Texture container[], const char *path, size_t nb_frame, size_t path_offset = 0)
+         */
+        void addArray(sf::Texture container[], const char *path, size_t nb_frame, size_t path_offset = 0);
+
+        /*!
+         * \copydoc addArray(sf::Texture container[], const char *path, size_t nb_frame, size_t path_offset = 0)
+         *
+         * The container is resized to `nb_frame`, and must not be resized until wait() returns.
+         */
+        void addArray(std::vector<sf::Texture> &container, const char *path, size_t nb_frame, size_t path_offset = 0);
+
+        /*!
+         * \brief Waits until the images are decoded, and uploads all the textures at once on the main thread (see Utils::MainThread).
+         */
+        void wait();
+
+      private:
+        std::vector<std::pair<sf::Texture *, std::future<sf::Image>>> pending;
+    };
+
+    template <typename T>
+    bool ResourceLoader::loadFile(T &resource, const std::string &path) {
+        if(std::optional<std::span<const char>> file = findFile(path)) {
+            return resource.loadFromMemory(file->data(), file->size());
+        }
+        return resource.loadFromFile(ResourceLoader::getResourcePath() + path);
+    }
+
     template <typename T>
     void ResourceLoader::load(T &resource, const char *path, bool fatal) {
         try{
-            if(!resource.loadFromFile(ResourceLoader::getResourcePath() + path)) {
+            if(!loadFile(resource, path)) {
                 throw LoadingException(path, fatal);
             }
         } catch (LoadingException& e) {
@@ -16,14 +16,27 @@
 #include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "./log.hpp"
+#include "ResourceLoader.hpp"
 #include "exceptions.hpp"
 
+namespace {
+    //The identifiers of the keys, shared by all the languages. Only used when a file is loaded or when an identifier is computed.
+    std::mutex idsMutex;
+    std::unordered_map<std::string, Utils::KeyId> ids;
+    std::vector<std::string> idsKeys;
+
+    const std::uint32_t NO_INDEX = UINT32_MAX;
+} // namespace
+
 namespace Utils {
 
-    sf::String StringKeys::readLine(std::ifstream &input) {
+    sf::String StringKeys::readLine(std::istream &input) {
         std::basic_string<unsigned char> toReturn;
         for(unsigned int i = 0; i < 1024; i++) {
             int got = input.get();
@@ -50,7 +63,7 @@ namespace Utils {
     }
 
     StringKeys::StringKeys(const std::string &keysFileS) {
-        std::ifstream keysFile(keysFileS);
+        std::unique_ptr<std::istream> keysFile = ResourceLoader::openFile(keysFileS);
         keys = std::vector<std::string>();
         strings = std::vector<sf::String>();
         Log::oplog("Keys initialization");
@@ -61,7 +74,7 @@ namespace Utils {
         int itore = 0;
         while(true) {
             sf::String read;
-            read = readLine(keysFile);
+            read = readLine(*keysFile);
             if((sfStringtoStdString(read) == "end")) { //Checks if the line is not the ending line
                 break;                                 //Else, stops reading
             }
@@ -69,7 +82,11 @@ namespace Utils {
             if(read[0] != '#' || read[0] != ' ' || !read.isEmpty()) { //Checks if the string is valid
                 std::vector<sf::String> strSplit = split(read, '=');
                 if(!strSplit.size() == 0 && strSplit[0] != "") {
-                    keys.push_back(strSplit[0]);
+                    std::string key = strSplit[0];
+                    if(key.starts_with("key.")) { //Removing "key" prefix
+                        key.erase(0, 4);
+                    }
+                    keys.push_back(key);
                     if(strSplit.size() < 2) {
                         strings.push_back(" ");
                     } else {
@@ -79,27 +96,81 @@ namespace Utils {
                 }
             }
         }
-    }
 
-    sf::String &StringKeys::get(std::string key) {
-        key = std::string("key.") + key;                //Adding "key" prefix
-        for(unsigned int i = 0; i < keys.size(); i++) { //Scans keys
-            if(keys[i] == key) {
-                return strings[i];
+        //Hash table and identifiers building
+        std::size_t tableSize = 1;
+        while(tableSize < keys.size() * 2) {
+            tableSize *= 2;
+        }
+        table.assign(tableSize, 0);
+        for(std::uint32_t i = 0; i < keys.size(); i++) {
+            if(getIndex(keys[i]) != NO_INDEX) { //If a key is defined twice, the first definition is used
+                continue;
+            }
+            std::size_t slot = std::hash<std::string_view>{}(keys[i]) & (tableSize - 1);
+            while(table[slot] != 0) {
+                slot = (slot + 1) & (tableSize - 1);
             }
+            table[slot] = i + 1;
+
+            std::size_t id = (std::size_t)getId(keys[i]);
+            if(indexes.size() <= id) {
+                indexes.resize(id + 1, NO_INDEX);
+            }
+            indexes[id] = i;
         }
-        Log::warn("Key " + key + " not found in the keys files.");
-        return strings[getIndex("void")]; //If nothing found, returns the empty string.
+
+        std::uint32_t voidIndex = getIndex("void");
+        voidString = (voidIndex != NO_INDEX) ? strings[voidIndex] : sf::String();
     }
 
-    int StringKeys::getIndex(std::string key) {
-        key = std::string("key.") + key;                //Adding "key" prefix
-        for(unsigned int i = 0; i < keys.size(); i++) { //Scans keys
-            if(keys[i] == key) {
-                return i;
+    KeyId StringKeys::getId(std::string_view key) {
+        std::lock_guard<std::mutex> lock(idsMutex);
+        auto itor = ids.emplace(std::string(key), (KeyId)idsKeys.size()).first;
+        if((std::size_t)itor->second == idsKeys.size()) {
+            idsKeys.push_back(itor->first);
+        }
+        return itor->second;
+    }
+
+    sf::String &StringKeys::get(std::string_view key) {
+        std::uint32_t index = getIndex(key);
+        if(index != NO_INDEX) {
+            return strings[index];
+        }
+        Log::warn("Key " + std::string(key) + " not found in the keys files.");
+        return voidString; //If nothing found, returns the empty string.
+    }
+
+    sf::String &StringKeys::get(KeyId key) {
+        if(key == KeyId::NONE) {
+            return voidString;
+        }
+        if((std::size_t)key < indexes.size() && indexes[(std::size_t)key] != NO_INDEX) {
+            return strings[indexes[(std::size_t)key]];
+        }
+        std::string name;
+        {
+            std::lock_guard<std::mutex> lock(idsMutex);
+            name = idsKeys[(std::size_t)key];
+        }
+        Log::warn("Key " + name + " not found in the keys files.");
+        return voidString;
+    }
+
+    std::uint32_t StringKeys::getIndex(std::string_view key) const {
+        if(table.empty()) {
+            return NO_INDEX;
+        }
+        //Linear probing, until the key or an empty slot is found
+        std::size_t slot = std::hash<std::string_view>{}(key) & (table.size() - 1);
+        while(table[slot] != 0) {
+            if(keys[table[slot] - 1] == key) {
+                return table[slot] - 1;
             }
+            slot = (slot + 1) & (table.size() - 1);
         }
-        return -1; //If nothing found, returns -1
+        return NO_INDEX;
     }
 
     sf::String StringKeys::split(sf::String const &str, char const &splitter, int const &part) {
@@ -151,7 +222,7 @@ namespace Utils {
         return instances;
     }
 
-    std::string StringKeys::getStd(std::string const &key) { return sfStringtoStdString(get(key)); }
+    std::string StringKeys::getStd(std::string_view key) { return sfStringtoStdString(get(key)); }
 
     std::queue<sf::String> StringKeys::autoNewLine(sf::String str,
                                                    sf::Font font,
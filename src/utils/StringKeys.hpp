@@ -10,8 +10,11 @@
 
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/System/String.hpp>
+#include <cstdint>
 #include <iostream>
 #include <queue>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "defines.hpp"
@@ -20,41 +23,71 @@
  *  \brief Contains different utilities.
  */
 namespace Utils {
+    /*!
+     * \brief Identifies a key, in every language (see StringKeys::getId).
+     */
+    enum class KeyId : std::uint32_t { NONE = UINT32_MAX };
+
 	/*!
      *  \brief Contains functions to manage game strings.
+     *  \details The keys are stored without their `key.` prefix. A string is found by its key with an open addressing hash table,
+     *  or directly by the identifier of its key, which can be computed once with getId().
      */
     class StringKeys {
     private:
         /*!
-         * \brief The array containing the keys.
-         * \todo Replace it by one map.
+         * \brief The array containing the keys, without the `key.` prefix.
          */
         std::vector<std::string> keys;
         /*!
-         * \brief The array containing the strings.
-         * \todo Replace it by one map.
+         * \brief The array containing the strings, in the same order as the keys.
          */
         std::vector<sf::String> strings;
+        /*!
+         * \brief The hash table of the keys : each slot contains an index in StringKeys::keys plus one, or 0 if it is empty.
+         * \details Its size is a power of two, at least twice the number of keys, and the collisions are resolved by linear probing.
+         */
+        std::vector<std::uint32_t> table;
+        /*!
+         * \brief The index in StringKeys::keys of each identifier, or UINT32_MAX if the key isn't in the file.
+         */
+        std::vector<std::uint32_t> indexes;
+        /*!
+         * \brief The string returned when a key is not found : the string of the `void` key, or an empty string.
+         */
+        sf::String voidString;
 
         /*!
-         * \brief Returns the index of the given key.
+         * \brief Returns the index of the given key, or UINT32_MAX if it isn't in the file.
          */
-        int getIndex(std::string key);
+        std::uint32_t getIndex(std::string_view key) const;
 
         /*!
          * \brief Reads a line from the input.
          */
-        sf::String readLine(std::ifstream &input);
+        sf::String readLine(std::istream &input);
     public:
         /*!
          * \return The character string associated with the key.
          * \param key The key corresponding to the wanted string.
          */
-        sf::String &get(std::string key);
+        sf::String &get(std::string_view key);
+        /*!
+         * \return The character string associated with the key.
+         * \param key The identifier of the key corresponding to the wanted string.
+         */
+        sf::String &get(KeyId key);
+
+        /*!
+         * \brief Returns the identifier of a key, to get its string without searching the key.
+         * \details The identifiers are the same in every language, so they can be kept after a language change.
+         * \param key The key, without the `key.` prefix.
+         */
+        static KeyId getId(std::string_view key);
 
         /*!
          * \brief Loads the file containing the keys and initializes the list of them.
-         * \param file The file to load, containing the keys.
+         * \param file The file to load, containing the keys, relative to the resource folder.
          */
         StringKeys(const std::string &file);
 
@@ -94,7 +127,7 @@ namespace Utils {
          * \return The string associated with the key in std::string format.
          * \param key The key corresponding to the wanted string.
          */
-        std::string getStd(std::string const &key);
+        std::string getStd(std::string_view key);
 
         /**
          * \brief Counts the number of instances of a character into a string.
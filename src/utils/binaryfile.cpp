@@ -0,0 +1,57 @@
+/*
+binaryfile.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "binaryfile.hpp"
+
+#include <cstring>
+
+#include "log.hpp"
+
+namespace Utils {
+    namespace BinaryFile {
+
+        void writeInt(std::string &buffer, std::uint32_t value, int bytes) {
+            for(int i = 0; i < bytes; i++) {
+                buffer.push_back((char)((value >> (8 * i)) & 0xFF));
+            }
+        }
+
+        void writeHeader(std::string &buffer, const char *magic, std::uint16_t version, std::uint32_t count) {
+            buffer.append(magic, 4);
+            writeInt(buffer, version, 2);
+            writeInt(buffer, BINARY_FILE_BYTE_ORDER, 2);
+            writeInt(buffer, count, 4);
+        }
+
+        std::optional<std::uint32_t> readHeader(const MappedFile &file, const std::string &path, const char *magic, std::uint16_t version, std::size_t entrySize,
+                                                const std::string &description) {
+            const char *data = file.getData();
+            if(file.getSize() < BINARY_FILE_HEADER_SIZE || std::memcmp(data, magic, 4) != 0) {
+                Log::warn(path + " is not a " + description + ".");
+                return std::nullopt;
+            }
+            std::uint16_t fileVersion;
+            std::uint16_t byteOrder;
+            std::uint32_t count;
+            std::memcpy(&fileVersion, data + 4, 2);
+            std::memcpy(&byteOrder, data + 6, 2);
+            std::memcpy(&count, data + 8, 4);
+            if(fileVersion != version || byteOrder != BINARY_FILE_BYTE_ORDER) {
+                Log::warn(path + " has been written with another version or byte order.");
+                return std::nullopt;
+            }
+            if((file.getSize() - BINARY_FILE_HEADER_SIZE) / entrySize < count) {
+                Log::warn(path + " is truncated.");
+                return std::nullopt;
+            }
+            return count;
+        }
+
+        bool contains(const MappedFile &file, std::uint32_t offset, std::uint32_t size) {
+            return (std::uint64_t)offset + size <= file.getSize();
+        }
+
+    } // namespace BinaryFile
+} // namespace Utils
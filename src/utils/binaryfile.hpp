@@ -0,0 +1,73 @@
+/*!
+ * \file binaryfile.hpp
+ * \brief Reading and writing of the headers of the binary files.
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "MappedFile.hpp"
+
+/*!
+ * \brief The size of the header of a binary file.
+ */
+#define BINARY_FILE_HEADER_SIZE 12
+/*!
+ * \brief The byte order mark written in the header.
+ */
+#define BINARY_FILE_BYTE_ORDER 0x0102
+
+namespace Utils {
+    /*!
+     * \namespace Utils::BinaryFile
+     * \brief Contains the functions shared by the binary files read from a memory mapping (like the map pack and the resource archive).
+     *
+     * These files start with a header containing a magic number (4 bytes), the version of the format (2 bytes), the byte order mark
+     * BINARY_FILE_BYTE_ORDER (2 bytes) and the number of entries of the index (4 bytes), followed by the index. All the values are little-endian.
+     *
+     * The values are read directly from the mapping, so a file can only be used if it has been written with the same byte order.
+     */
+    namespace BinaryFile {
+
+        /*!
+         * \brief Appends an integer in little-endian.
+         * \param buffer The content of the file being written.
+         * \param value The value to write.
+         * \param bytes The number of bytes to write, up to 4.
+         */
+        void writeInt(std::string &buffer, std::uint32_t value, int bytes);
+
+        /*!
+         * \brief Appends a header.
+         * \param buffer The content of the file being written.
+         * \param magic The magic number, of 4 characters.
+         * \param version The version of the format.
+         * \param count The number of entries of the index.
+         */
+        void writeHeader(std::string &buffer, const char *magic, std::uint16_t version, std::uint32_t count);
+
+        /*!
+         * \brief Checks the header of a mapped file, and that its index fits in it. A warning is written if the file is invalid.
+         * \param file The mapped file.
+         * \param path The path of the file, used in the warnings.
+         * \param magic The expected magic number.
+         * \param version The expected version of the format.
+         * \param entrySize The size of an entry of the index.
+         * \param description The kind of file, used in the warnings (for example "map pack").
+         * \returns The number of entries of the index, or nothing if the file is invalid.
+         */
+        std::optional<std::uint32_t> readHeader(const MappedFile &file, const std::string &path, const char *magic, std::uint16_t version, std::size_t entrySize,
+                                                const std::string &description);
+
+        /*!
+         * \returns `true` if the given range is in the mapped file.
+         */
+        bool contains(const MappedFile &file, std::uint32_t offset, std::uint32_t size);
+
+    } // namespace BinaryFile
+} // namespace Utils
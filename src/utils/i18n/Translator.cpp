@@ -29,7 +29,8 @@ namespace Utils {
                           Desactivated : if we need to reload the keys
             */
 
-            stringkeys = StringKeys(Utils::ResourceLoader::getResourcePath() + langMap[langCode]);
+            std::lock_guard<std::recursive_mutex> lock(listenersMutex);
+            stringkeys = StringKeys(langMap[langCode]);
 
             _currentLang = langCode;
             for(auto &listener : _listeners) {
@@ -46,6 +47,7 @@ namespace Utils {
         }
 
         void Translator::subscribe(ATranslatable *listener) {
+            std::lock_guard<std::recursive_mutex> lock(listenersMutex);
             auto result = _listeners.insert(listener);
             if(!result.second) {
                 Utils::Log::warn("Translator: a listener is trying to subscribe twice.");
@@ -53,6 +55,7 @@ namespace Utils {
         }
 
         void Translator::unsubscribe(ATranslatable *listener) {
+            std::lock_guard<std::recursive_mutex> lock(listenersMutex);
             if(!_listeners.erase(listener)) {
                 Utils::Log::warn("Translator: a listener not registered is trying to unsubscribe.");
             }
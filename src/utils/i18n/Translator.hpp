@@ -6,6 +6,7 @@
 #pragma once
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include "../StringKeys.hpp"
@@ -48,7 +49,14 @@ namespace Utils {
              */
             const std::map<const std::string, const std::string> getAvailableLanguages();
 
+            /*!
+             * \brief Registers an instance to inform when the lang changes.
+             * \details Can be called from any thread, since the maps are loaded in the background (see Overworld::prefetchMaps).
+             */
             void subscribe(ATranslatable *listener);
+            /*!
+             * \copydoc subscribe
+             */
             void unsubscribe(ATranslatable *listener);
 
             /*!
@@ -68,6 +76,10 @@ namespace Utils {
 
             std::string _currentLang;
             std::unordered_set<ATranslatable *> _listeners;
+            /*!
+             * \brief Protects `_listeners`. Recursive, since a listener may create or destroy other listeners when the lang changes.
+             */
+            std::recursive_mutex listenersMutex;
 
             StringKeys stringkeys;
         };
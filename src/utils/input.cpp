@@ -0,0 +1,254 @@
+/*
+input.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "input.hpp"
+
+#include <SFML/Window/Window.hpp>
+#include <bitset>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include "exceptions.hpp"
+#include "log.hpp"
+#include "misc.hpp"
+
+#define INPUT_LOG_MAGIC "OPIN"
+#define INPUT_LOG_VERSION 2
+//Kinds of records
+#define RECORD_EVENT 0
+#define RECORD_KEY 1
+
+namespace {
+    enum class Mode { LIVE, RECORD, REPLAY };
+
+    Mode mode = Mode::LIVE;
+    bool keyboardEnabled = true;
+    std::uint32_t tick = 0;
+
+    //Recording
+    std::ofstream recordFile;
+    //Keys already recorded as pressed during the current tick
+    std::bitset<sf::Keyboard::KeyCount> recordedKeys;
+
+    //Replaying
+    std::deque<std::pair<std::uint32_t, sf::Event>> replayEvents;
+    std::deque<std::pair<std::uint32_t, sf::Keyboard::Key>> replayKeys;
+    //Keys pressed during the current tick
+    std::bitset<sf::Keyboard::KeyCount> replayPressed;
+    std::uint32_t replayLastTick = 0;
+
+    void writeInt(std::ostream &stream, std::uint32_t value, int bytes) {
+        for(int i = 0; i < bytes; i++) {
+            stream.put((char)((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    std::uint32_t readInt(std::istream &stream, int bytes) {
+        std::uint32_t value = 0;
+        for(int i = 0; i < bytes; i++) {
+            value |= (std::uint32_t)(std::uint8_t)stream.get() << (8 * i);
+        }
+        return value;
+    }
+
+    void writeEvent(const sf::Event &event) {
+        writeInt(recordFile, tick, 4);
+        writeInt(recordFile, RECORD_EVENT, 1);
+        writeInt(recordFile, event.type, 1);
+        switch(event.type) {
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased:
+            writeInt(recordFile, (std::uint16_t)(std::int16_t)event.key.code, 2);
+            writeInt(recordFile, event.key.alt | event.key.control << 1 | event.key.shift << 2 | event.key.system << 3, 1);
+            break;
+        case sf::Event::Resized:
+            writeInt(recordFile, event.size.width, 4);
+            writeInt(recordFile, event.size.height, 4);
+            break;
+        case sf::Event::TextEntered:
+            writeInt(recordFile, event.text.unicode, 4);
+            break;
+        default:
+            break;
+        }
+    }
+
+    sf::Event readEvent(std::istream &stream) {
+        sf::Event event{};
+        event.type = (sf::Event::EventType)readInt(stream, 1);
+        switch(event.type) {
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased: {
+            event.key.code = (sf::Keyboard::Key)(std::int16_t)readInt(stream, 2);
+            std::uint32_t modifiers = readInt(stream, 1);
+            event.key.alt = modifiers & 0x1;
+            event.key.control = modifiers & 0x2;
+            event.key.shift = modifiers & 0x4;
+            event.key.system = modifiers & 0x8;
+            break;
+        }
+        case sf::Event::Resized:
+            event.size.width = readInt(stream, 4);
+            event.size.height = readInt(stream, 4);
+            break;
+        case sf::Event::TextEntered:
+            event.text.unicode = readInt(stream, 4);
+            break;
+        default:
+            break;
+        }
+        return event;
+    }
+
+    //Updates replayPressed with the keys recorded for the current tick
+    void loadReplayKeys() {
+        replayPressed.reset();
+        while(!replayKeys.empty() && replayKeys.front().first <= tick) {
+            if(replayKeys.front().first == tick) {
+                replayPressed.set(replayKeys.front().second);
+            }
+            replayKeys.pop_front();
+        }
+    }
+} // namespace
+
+namespace Utils {
+    namespace Input {
+
+        bool startRecording(const std::string &path, StartMode start) {
+            stop();
+            recordFile.open(path, std::ios::binary);
+            if(!recordFile) {
+                Log::warn("Unable to record the inputs in " + path);
+                return false;
+            }
+            recordFile.write(INPUT_LOG_MAGIC, 4);
+            writeInt(recordFile, INPUT_LOG_VERSION, 1);
+            writeInt(recordFile, Misc::getRNGSeed(), 4);
+            writeInt(recordFile, (std::uint8_t)start, 1);
+            mode = Mode::RECORD;
+            tick = 0;
+            recordedKeys.reset();
+            Log::oplog("Recording the inputs in " + path);
+            return true;
+        }
+
+        void startReplay(const std::string &path, StartMode start) {
+            stop();
+            std::ifstream file(path, std::ios::binary);
+            char magic[4] = {0};
+            file.read(magic, 4);
+            if(!file || std::string(magic, 4) != INPUT_LOG_MAGIC || readInt(file, 1) != INPUT_LOG_VERSION) {
+                throw LoadingException(path, true);
+            }
+            std::uint32_t seed = readInt(file, 4);
+            //The same inputs given to another screen would lead to another session
+            if(readInt(file, 1) != (std::uint8_t)start) {
+                throw UnexpectedValueException(path, start == StartMode::OVERWORLD ? "an input log recorded in headless mode" : "an input log recorded with the window");
+            }
+            Misc::setRNGSeed(seed);
+
+            replayLastTick = 0;
+            while(file.peek() != std::ifstream::traits_type::eof()) {
+                std::uint32_t recordTick = readInt(file, 4);
+                std::uint32_t kind = readInt(file, 1);
+                if(kind == RECORD_EVENT) {
+                    replayEvents.emplace_back(recordTick, readEvent(file));
+                } else if(kind == RECORD_KEY) {
+                    replayKeys.emplace_back(recordTick, (sf::Keyboard::Key)readInt(file, 1));
+                } else {
+                    throw LoadingException(path, true);
+                }
+                if(!file) {
+                    throw LoadingException(path, true);
+                }
+                replayLastTick = recordTick;
+            }
+
+            mode = Mode::REPLAY;
+            tick = 0;
+            loadReplayKeys();
+            Log::oplog("Replaying the inputs from " + path + " (" + std::to_string(replayLastTick) + " ticks)");
+        }
+
+        void stop() {
+            if(recordFile.is_open()) {
+                recordFile.close();
+            }
+            replayEvents.clear();
+            replayKeys.clear();
+            replayPressed.reset();
+            mode = Mode::LIVE;
+        }
+
+        void setKeyboardEnabled(bool enabled) {
+            keyboardEnabled = enabled;
+        }
+
+        bool pollEvent(sf::Window *window, sf::Event &event) {
+            if(mode == Mode::REPLAY) {
+                //The window's events must still be polled to keep it responsive.
+                while(window != nullptr && window->pollEvent(event)) {
+                    if(event.type == sf::Event::Closed) {
+                        return true;
+                    }
+                }
+                if(!replayEvents.empty() && replayEvents.front().first <= tick) {
+                    event = replayEvents.front().second;
+                    replayEvents.pop_front();
+                    return true;
+                }
+                return false;
+            }
+
+            if(window == nullptr || !window->pollEvent(event)) {
+                return false;
+            }
+            if(mode == Mode::RECORD) {
+                writeEvent(event);
+            }
+            return true;
+        }
+
+        bool isKeyPressed(sf::Keyboard::Key key) {
+            if(key < 0 || key >= sf::Keyboard::KeyCount) {
+                return false;
+            }
+            if(mode == Mode::REPLAY) {
+                return replayPressed.test(key);
+            }
+
+            bool pressed = keyboardEnabled && sf::Keyboard::isKeyPressed(key);
+            if(mode == Mode::RECORD && pressed && !recordedKeys.test(key)) {
+                recordedKeys.set(key);
+                writeInt(recordFile, tick, 4);
+                writeInt(recordFile, RECORD_KEY, 1);
+                writeInt(recordFile, key, 1);
+            }
+            return pressed;
+        }
+
+        void nextTick() {
+            tick++;
+            if(mode == Mode::RECORD) {
+                recordedKeys.reset();
+            } else if(mode == Mode::REPLAY) {
+                loadReplayKeys();
+            }
+        }
+
+        bool hasPendingEvents() {
+            return mode == Mode::REPLAY && !replayEvents.empty() && replayEvents.front().first <= tick;
+        }
+
+        bool isReplayOver() {
+            return mode == Mode::REPLAY && replayEvents.empty() && tick > replayLastTick;
+        }
+
+    } // namespace Input
+} // namespace Utils
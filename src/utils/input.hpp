@@ -0,0 +1,105 @@
+/*!
+ * \file input.hpp
+ * \brief Input reading, recording and replaying.
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <cstdint>
+#include <string>
+
+namespace sf {
+    class Window;
+}
+
+namespace Utils {
+    /*!
+     * \namespace Utils::Input
+     * \brief Contains the functions reading the player's inputs.
+     *
+     * The game must read its inputs (events and keyboard state) through these functions instead of using SFML directly,
+     * so the inputs can be recorded in a file and replayed later to reproduce a session exactly.
+     *
+     * The inputs are stamped with the number of ticks elapsed, incremented with nextTick(). The log file starts with
+     * a header containing the seed of the random generator (see Utils::Misc::getRNGSeed) and the start mode (1 byte), followed by the records.
+     * Each record is made of the tick (4 bytes), the kind of record (1 byte) and its data :
+     * - An event : its type (1 byte) and the fields used for this type.
+     * - A key pressed : the key (1 byte). Only the keys found pressed are recorded, once per tick.
+     * All the values are little-endian.
+     */
+    namespace Input {
+
+        /*!
+         * \brief The screen from which the game starts. A log can only be replayed from the screen it has been recorded from.
+         */
+        enum class StartMode : std::uint8_t {
+            MAIN_MENU,
+            /*!
+             * \brief The overworld, without going through the menus (headless mode).
+             */
+            OVERWORLD
+        };
+
+        /*!
+         * \brief Starts recording the inputs in a file.
+         * \param path The path of the log to write.
+         * \param start The screen from which the game starts.
+         * \returns `false` if the file can't be opened.
+         */
+        bool startRecording(const std::string &path, StartMode start);
+
+        /*!
+         * \brief Loads a log recorded with startRecording(). The inputs will then be read from the log instead of the keyboard.
+         * \details The random generator is seeded with the seed found in the log.
+         * \param path The path of the log to read.
+         * \param start The screen from which the game starts.
+         * \throws LoadingException If the file can't be read or isn't a valid input log.
+         * \throws UnexpectedValueException If the log has been recorded from another screen.
+         */
+        void startReplay(const std::string &path, StartMode start);
+
+        /*!
+         * \brief Stops recording or replaying, and closes the log.
+         */
+        void stop();
+
+        /*!
+         * \brief Enables or disables the real keyboard. If disabled, and if not replaying, no key is considered pressed.
+         * \details Disabled in headless mode, where no display is available to read the keyboard from.
+         */
+        void setKeyboardEnabled(bool enabled);
+
+        /*!
+         * \brief Gets the next event, like sf::Window::pollEvent.
+         * \details When replaying, the events of the window are discarded (except sf::Event::Closed) and the recorded events of the current tick are returned instead.
+         * \param window The window to get the events from. Can be `nullptr` if there is no window.
+         * \param event Filled with the event, if there is one.
+         * \returns `true` if an event was returned.
+         */
+        bool pollEvent(sf::Window *window, sf::Event &event);
+
+        /*!
+         * \brief Checks if a key is pressed, like sf::Keyboard::isKeyPressed.
+         */
+        bool isKeyPressed(sf::Keyboard::Key key);
+
+        /*!
+         * \brief Must be called at the end of each tick.
+         */
+        void nextTick();
+
+        /*!
+         * \returns `true` if the replay has recorded events left for the current tick. The next tick must not be run before they are polled.
+         */
+        bool hasPendingEvents();
+
+        /*!
+         * \returns `true` if a replay has been loaded and all its inputs have been used.
+         */
+        bool isReplayOver();
+
+    } // namespace Input
+} // namespace Utils
@@ -0,0 +1,89 @@
+/*
+jsonindex.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "jsonindex.hpp"
+
+#include "../nlohmann/json.hpp"
+#include "exceptions.hpp"
+
+namespace {
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    //Returns the position following the string starting at begin (the opening quote)
+    std::size_t skipString(std::string_view json, std::size_t begin) {
+        for(std::size_t i = begin + 1; i < json.size(); i++) {
+            if(json[i] == '\\') {
+                i++;
+            } else if(json[i] == '"') {
+                return i + 1;
+            }
+        }
+        throw Utils::UnexpectedValueException("unterminated string", "a json string", false);
+    }
+
+    std::size_t skipSpaces(std::string_view json, std::size_t i) {
+        while(i < json.size() && isSpace(json[i])) {
+            i++;
+        }
+        return i;
+    }
+} // namespace
+
+namespace Utils {
+    namespace JsonIndex {
+
+        std::vector<Entry> indexArray(std::string_view json, const std::string &key) {
+            std::vector<Entry> entries;
+            //Quoted key, to compare it with the text without unescaping it
+            std::string quotedKey = "\"" + key + "\"";
+
+            std::size_t i = skipSpaces(json, 0);
+            if(i >= json.size() || json[i] != '[') {
+                throw UnexpectedValueException(std::string(json.substr(i, 16)), "a json array", false);
+            }
+
+            //The array is at depth 1, its objects at depth 2
+            int depth = 0;
+            std::size_t objectStart = 0;
+            for(; i < json.size(); i++) {
+                char c = json[i];
+                if(c == '"') {
+                    std::size_t end = skipString(json, i);
+                    if(depth == 2) {
+                        std::size_t next = skipSpaces(json, end);
+                        //A key of the object, followed by a string value
+                        if(next < json.size() && json[next] == ':' && json.substr(i, end - i) == quotedKey) {
+                            std::size_t valueStart = skipSpaces(json, next + 1);
+                            if(valueStart < json.size() && json[valueStart] == '"') {
+                                std::size_t valueEnd = skipString(json, valueStart);
+                                entries.back().key = nlohmann::json::parse(json.begin() + valueStart, json.begin() + valueEnd).get<std::string>();
+                                end = valueEnd;
+                            }
+                        }
+                    }
+                    i = end - 1;
+                } else if(c == '{' || c == '[') {
+                    depth++;
+                    if(depth == 2) {
+                        objectStart = i;
+                        entries.push_back(Entry());
+                    }
+                } else if(c == '}' || c == ']') {
+                    if(depth == 2) {
+                        entries.back().source = json.substr(objectStart, i + 1 - objectStart);
+                    }
+                    depth--;
+                    if(depth == 0) {
+                        break;
+                    }
+                }
+            }
+            return entries;
+        }
+
+    } // namespace JsonIndex
+} // namespace Utils
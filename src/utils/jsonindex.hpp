@@ -0,0 +1,45 @@
+/*!
+ * \file jsonindex.hpp
+ * \brief Indexing of big json arrays without parsing them.
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Utils {
+    /*!
+     * \namespace Utils::JsonIndex
+     * \brief Contains a streaming pass finding the objects of a json array, so they can be parsed separately when they are needed.
+     */
+    namespace JsonIndex {
+
+        /*!
+         * \brief An object of the indexed array.
+         */
+        struct Entry {
+            /*!
+             * \brief The value of the indexed key in the object, or an empty string if the object doesn't contain it.
+             */
+            std::string key;
+            /*!
+             * \brief The text of the object, from its `{` to its `}`.
+             */
+            std::string_view source;
+        };
+
+        /*!
+         * \brief Finds the objects of a json array.
+         * \details The text is read once, only keeping track of the strings and of the depth : the objects aren't parsed, and the text isn't checked.
+         * The errors in an object will be found when it is parsed.
+         * \param json The text of the array. The returned entries point in it.
+         * \param key The key whose string value is returned for each object. Only the keys of the objects themselves are read, not the ones of their children.
+         * \throws UnexpectedValueException If the text isn't an array.
+         */
+        std::vector<Entry> indexArray(std::string_view json, const std::string &key);
+
+    } // namespace JsonIndex
+} // namespace Utils
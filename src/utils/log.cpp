@@ -8,6 +8,7 @@ File under GNU GPL v3.0
 
 #include <iostream>
 #include <fstream>
+#include <mutex>
 
 #include "./fs.hpp"
 #include "./time.hpp"
@@ -17,6 +18,8 @@ File under GNU GPL v3.0
 std::ostream *rlog = nullptr;
 /**Error log*/
 std::ostream *rerrLog = nullptr;
+/**Protects the log streams, written by the loading and pool threads too*/
+std::mutex logMutex;
 
 namespace Utils {
     namespace Log {
@@ -45,6 +48,7 @@ namespace Utils {
                 throw NullptrException("log stream or error log stream", false);
             }
             std::ostream *logStream = error ? rerrLog : rlog;
+            std::lock_guard<std::mutex> lock(logMutex);
             *logStream << "[T = " << Time::getElapsedMilliseconds() << "] - " << toSay << std::endl;
         }
 
@@ -26,6 +26,8 @@ namespace Utils {
         /*!
          * \brief Write a log message in a log file.
          *
+         * Can be called from any thread.
+         *
          * \param toSay message to write.
          * \param bool if `true` the log message will be written in the error log file; otherwise, it will be written in the regular log file.
          */
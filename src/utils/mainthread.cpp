@@ -0,0 +1,58 @@
+/*
+mainthread.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "mainthread.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace {
+    //Static initialization is done by the main thread.
+    const std::thread::id mainThreadId = std::this_thread::get_id();
+
+    std::mutex tasksMutex;
+    std::condition_variable tasksCondition;
+    std::deque<std::packaged_task<void()>> tasks;
+} // namespace
+
+namespace Utils {
+    namespace MainThread {
+
+        bool isMainThread() {
+            return std::this_thread::get_id() == mainThreadId;
+        }
+
+        void run(std::function<void()> task) {
+            if(isMainThread()) {
+                task();
+                return;
+            }
+            std::packaged_task<void()> packagedTask(std::move(task));
+            std::future<void> done = packagedTask.get_future();
+            {
+                std::lock_guard<std::mutex> lock(tasksMutex);
+                tasks.push_back(std::move(packagedTask));
+            }
+            tasksCondition.notify_one();
+            done.get();
+        }
+
+        void processTasks(std::chrono::milliseconds duration) {
+            auto end = std::chrono::steady_clock::now() + duration;
+            std::unique_lock<std::mutex> lock(tasksMutex);
+            while(tasksCondition.wait_until(lock, end, [] { return !tasks.empty(); })) {
+                std::packaged_task<void()> task = std::move(tasks.front());
+                tasks.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+
+    } // namespace MainThread
+} // namespace Utils
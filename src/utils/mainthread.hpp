@@ -0,0 +1,42 @@
+/*!
+ * \file mainthread.hpp
+ * \brief Allows other threads to run tasks on the main thread.
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+namespace Utils {
+    /*!
+     * \namespace Utils::MainThread
+     * \brief Contains the functions used by the other threads to run tasks on the main thread.
+     *
+     * Some tasks, like uploading a texture to the graphic card, must be done on the main thread. A thread loading
+     * resources in the background can hand them over with run(), while the main thread calls processTasks() regularly.
+     */
+    namespace MainThread {
+
+        /*!
+         * \returns `true` if the calling thread is the main thread.
+         */
+        bool isMainThread();
+
+        /*!
+         * \brief Runs a task on the main thread, and waits until it is done.
+         * \details If called from the main thread, the task is run immediately. Otherwise, the task is run during the next call to processTasks().
+         * An exception thrown by the task is thrown again by this function.
+         * \warning From another thread, this function blocks until the main thread calls processTasks().
+         */
+        void run(std::function<void()> task);
+
+        /*!
+         * \brief Runs the tasks given by the other threads during the given duration.
+         * \details Must be called from the main thread.
+         */
+        void processTasks(std::chrono::milliseconds duration);
+
+    } // namespace MainThread
+} // namespace Utils
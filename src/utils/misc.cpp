@@ -5,26 +5,30 @@ File under GNU GPL v3.0
  */
 #include "misc.hpp"
 
-#include <algorithm>  //std::generate
-#include <array>      //std::array
-#include <functional> //std::ref
-#include <random>     //std::mt19937, std::seed_seq, std::random_device
+#include <random>     //std::mt19937, std::random_device
 
 namespace Utils::Misc {
 
-	std::mt19937 &getRNGEngine() {
-		static std::mt19937 mt = []() {
-			std::array<std::mt19937::result_type, std::mt19937::state_size> data;
-			std::random_device device;
-			std::generate(data.begin(), data.end(), std::ref(device));
-			std::seed_seq seed(data.begin(), data.end());
-			mt.seed(seed);
-			return mt;
-		}();
+	//The seed is a single integer, so it can be saved to reproduce a run (see Utils::Input).
+	static std::uint32_t &rngSeed() {
+		static std::uint32_t seed = std::random_device{}();
+		return seed;
+	}
 
+	std::mt19937 &getRNGEngine() {
+		static std::mt19937 mt(rngSeed());
 		return mt;
 	}
 
+	std::uint32_t getRNGSeed() {
+		return rngSeed();
+	}
+
+	void setRNGSeed(std::uint32_t seed) {
+		rngSeed() = seed;
+		getRNGEngine().seed(seed);
+	}
+
 	int randU(int limit) {
 		return random_(0, limit - 1);
 	}
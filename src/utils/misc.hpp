@@ -14,6 +14,7 @@
 #define UTILS_HPP
 
 #include <cassert>     //assert
+#include <cstdint>     //std::uint32_t
 #include <random>      //std::uniform_real_distribution, std::uniform_int_distribution
 #include <type_traits> //std::is_floating_point_v, std::is_same_v
 #include <iosfwd>
@@ -36,6 +37,16 @@ namespace Utils::Misc {
 
 	std::mt19937 &getRNGEngine();
 
+	/*!
+	 * \returns The seed used by the random generator returned by getRNGEngine().
+	 */
+	std::uint32_t getRNGSeed();
+
+	/*!
+	 * \brief Reseeds the random generator returned by getRNGEngine(), to reproduce a previous run.
+	 */
+	void setRNGSeed(std::uint32_t seed);
+
 	///\brief Generates a random number of type T in the range [min, max]
 	///\details Example: random_<int>(0, 255);
 	///Example: random_('a', 'z');
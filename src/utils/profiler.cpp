@@ -0,0 +1,169 @@
+/*
+profiler.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "log.hpp"
+
+//Number of zones kept in memory
+#define ZONES_CAPACITY 16384
+//Number of frame durations kept in memory
+#define FRAMES_CAPACITY 1024
+
+namespace {
+    /*!
+     * \brief A slot of the zones ring buffer.
+     * \details `sequence` is odd while the slot is being written, so a reader can detect and skip a slot written at the same time.
+     */
+    struct ZoneRecord {
+        std::atomic<unsigned long long> sequence{0};
+        std::atomic<const char *> name{nullptr};
+        std::atomic<long long> start{0};
+        std::atomic<long long> duration{0};
+        std::atomic<unsigned int> thread{0};
+    };
+
+    struct ZoneCopy {
+        const char *name;
+        long long start;
+        long long duration;
+        unsigned int thread;
+    };
+
+    ZoneRecord zones[ZONES_CAPACITY];
+    std::atomic<unsigned long long> zonesCount{0};
+
+    std::atomic<long long> frameDurations[FRAMES_CAPACITY];
+    std::atomic<unsigned long long> framesCount{0};
+
+    std::atomic<unsigned int> threadsCount{0};
+    thread_local unsigned int threadId = threadsCount++;
+
+    const std::chrono::steady_clock::time_point reference = std::chrono::steady_clock::now();
+
+    //Microseconds elapsed since the beginning of the program
+    long long now() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - reference).count();
+    }
+
+    void record(const char *name, long long start, long long duration) {
+        unsigned long long index = zonesCount.fetch_add(1, std::memory_order_relaxed);
+        ZoneRecord &slot = zones[index % ZONES_CAPACITY];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.start.store(start, std::memory_order_relaxed);
+        slot.duration.store(duration, std::memory_order_relaxed);
+        slot.thread.store(threadId, std::memory_order_relaxed);
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+    }
+
+    std::vector<ZoneCopy> copyZones() {
+        std::vector<ZoneCopy> copy;
+        copy.reserve(ZONES_CAPACITY);
+        for(ZoneRecord &slot : zones) {
+            unsigned long long sequence = slot.sequence.load(std::memory_order_acquire);
+            if(sequence == 0 || sequence % 2 == 1) {
+                continue; //Empty or being written
+            }
+            ZoneCopy zone{slot.name.load(std::memory_order_relaxed), slot.start.load(std::memory_order_relaxed),
+                          slot.duration.load(std::memory_order_relaxed), slot.thread.load(std::memory_order_relaxed)};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot.sequence.load(std::memory_order_relaxed) == sequence) {
+                copy.push_back(zone);
+            }
+        }
+        std::sort(copy.begin(), copy.end(), [](const ZoneCopy &a, const ZoneCopy &b) { return a.start < b.start; });
+        return copy;
+    }
+
+    //Nearest-rank percentile of a sorted vector
+    long long percentile(const std::vector<long long> &sorted, double p) {
+        std::size_t rank = (std::size_t)std::ceil(p * sorted.size());
+        return sorted[std::max<std::size_t>(rank, 1) - 1];
+    }
+} // namespace
+
+namespace Utils {
+    namespace Profiler {
+
+        Zone::Zone(const char *name)
+          : name(name)
+          , start(now()) {
+        }
+
+        Zone::~Zone() {
+            record(name, start, now() - start);
+        }
+
+        void frameMark() {
+            static long long lastFrame = -1;
+            long long time = now();
+            if(lastFrame >= 0) {
+                unsigned long long index = framesCount.load(std::memory_order_relaxed);
+                frameDurations[index % FRAMES_CAPACITY].store(time - lastFrame, std::memory_order_relaxed);
+                framesCount.store(index + 1, std::memory_order_release);
+                record("Frame", lastFrame, time - lastFrame);
+            }
+            lastFrame = time;
+        }
+
+        std::string getSummary() {
+            unsigned long long count = framesCount.load(std::memory_order_acquire);
+            std::vector<long long> durations;
+            for(unsigned long long i = (count > FRAMES_CAPACITY ? count - FRAMES_CAPACITY : 0); i < count; i++) {
+                durations.push_back(frameDurations[i % FRAMES_CAPACITY].load(std::memory_order_relaxed));
+            }
+            if(durations.empty()) {
+                return "No frame recorded.";
+            }
+            std::sort(durations.begin(), durations.end());
+            long long total = 0;
+            for(long long duration : durations) {
+                total += duration;
+            }
+
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(2);
+            oss << durations.size() << " frames - average: " << total / 1000.0 / durations.size() << "ms"
+                << ", p50: " << percentile(durations, 0.50) / 1000.0 << "ms"
+                << ", p95: " << percentile(durations, 0.95) / 1000.0 << "ms"
+                << ", p99: " << percentile(durations, 0.99) / 1000.0 << "ms"
+                << ", max: " << durations.back() / 1000.0 << "ms";
+            return oss.str();
+        }
+
+        bool dump(const std::string &path) {
+            std::ofstream file(path);
+            if(!file) {
+                Log::warn("Unable to write the profile in " + path);
+                return false;
+            }
+
+            file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            bool first = true;
+            for(const ZoneCopy &zone : copyZones()) {
+                file << (first ? "\n" : ",\n") << "{\"name\":\"" << zone.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.thread
+                     << ",\"ts\":" << zone.start << ",\"dur\":" << zone.duration << "}";
+                first = false;
+            }
+            file << "\n]}" << std::endl;
+
+            Log::oplog("Profile written in " + path);
+            Log::oplog("Frame times: " + getSummary());
+            return true;
+        }
+
+    } // namespace Profiler
+} // namespace Utils
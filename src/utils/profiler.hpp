@@ -0,0 +1,60 @@
+/*!
+ * \file profiler.hpp
+ * \brief Frame profiling utilities.
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <string>
+
+namespace Utils {
+    /*!
+     * \namespace Utils::Profiler
+     * \brief Contains a small profiler measuring where the time of each frame goes.
+     *
+     * The profiler records timed zones (see Zone) and frame durations (see frameMark()) in fixed-size ring buffers,
+     * keeping only the most recent entries. Recording is lock-free and can be done from any thread.
+     * The buffers can then be dumped in the Chrome `trace_event` format, readable in chrome://tracing or Perfetto.
+     */
+    namespace Profiler {
+
+        /*!
+         * \brief Measures the time spent in a scope.
+         * \details The zone is recorded when the object is destroyed. Usage : `Utils::Profiler::Zone zone("Name");`
+         */
+        class Zone {
+          public:
+            /*!
+             * \param name The name of the zone. It must be a string literal, since only the pointer is stored.
+             */
+            explicit Zone(const char *name);
+            ~Zone();
+            Zone(const Zone &) = delete;
+            Zone &operator=(const Zone &) = delete;
+
+          private:
+            const char *name;
+            long long start;
+        };
+
+        /*!
+         * \brief Marks the beginning of a new frame.
+         * \details The time elapsed since the previous call is recorded as the duration of the previous frame.
+         */
+        void frameMark();
+
+        /*!
+         * \brief Writes the recorded zones in a Chrome `trace_event` JSON file, and logs a summary of the frame times.
+         * \param path The path of the file to write.
+         * \returns `false` if the file can't be written.
+         */
+        bool dump(const std::string &path);
+
+        /*!
+         * \returns A summary of the recorded frame times : number of frames, average, p50, p95, p99 and maximum.
+         */
+        std::string getSummary();
+
+    } // namespace Profiler
+} // namespace Utils
@@ -0,0 +1,108 @@
+/*
+threadpool.cpp
+Author : agent
+File under GNU GPL v3.0
+*/
+#include "threadpool.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    class Pool {
+      public:
+        Pool() {
+            //The thread waiting for the results also runs tasks, so one core is left to it
+            std::size_t count = std::max(2u, std::thread::hardware_concurrency()) - 1;
+            for(std::size_t i = 0; i < count; i++) {
+                threads.emplace_back([this]() { work(); });
+            }
+        }
+
+        ~Pool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopped = true;
+            }
+            condition.notify_all();
+            for(std::thread &thread : threads) {
+                thread.join();
+            }
+        }
+
+        void push(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                tasks.push_back(std::move(task));
+            }
+            condition.notify_one();
+        }
+
+        bool runTask() {
+            std::function<void()> task;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(tasks.empty()) {
+                    return false;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+            return true;
+        }
+
+        std::size_t size() const {
+            return threads.size();
+        }
+
+      private:
+        void work() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(true) {
+                condition.wait(lock, [this] { return stopped || !tasks.empty(); });
+                if(stopped) {
+                    return;
+                }
+                std::function<void()> task = std::move(tasks.front());
+                tasks.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::function<void()>> tasks;
+        bool stopped = false;
+        std::vector<std::thread> threads;
+    };
+
+    Pool &getPool() {
+        static Pool pool;
+        return pool;
+    }
+} // namespace
+
+namespace Utils {
+    namespace ThreadPool {
+
+        std::size_t getThreadsCount() {
+            return getPool().size();
+        }
+
+        void push(std::function<void()> task) {
+            getPool().push(std::move(task));
+        }
+
+        bool runTask() {
+            return getPool().runTask();
+        }
+
+    } // namespace ThreadPool
+} // namespace Utils
@@ -0,0 +1,78 @@
+/*!
+ * \file threadpool.hpp
+ * \brief Runs tasks in parallel on a pool of threads.
+ * \authors agent
+ * \copyright GNU GPL v3.0
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "mainthread.hpp"
+
+namespace Utils {
+    /*!
+     * \namespace Utils::ThreadPool
+     * \brief Contains the functions used to run tasks on a pool of threads, one for each core of the processor.
+     *
+     * The pool is used to decode the resources in parallel, like the images and the sounds. The tasks must not wait
+     * for the main thread while holding a lock the main thread may need (see Utils::MainThread).
+     */
+    namespace ThreadPool {
+
+        /*!
+         * \returns The number of threads in the pool.
+         */
+        std::size_t getThreadsCount();
+
+        /*!
+         * \brief Adds a task to the queue of the pool.
+         */
+        void push(std::function<void()> task);
+
+        /*!
+         * \brief Runs the next task of the queue in the calling thread.
+         * \returns `false` if the queue is empty.
+         */
+        bool runTask();
+
+        /*!
+         * \brief Runs a function on the pool.
+         * \returns A future containing the result of the function, or the exception it has thrown.
+         */
+        template <typename F>
+        std::future<std::invoke_result_t<F>> submit(F &&function) {
+            auto task = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(function));
+            std::future<std::invoke_result_t<F>> result = task->get_future();
+            push([task]() { (*task)(); });
+            return result;
+        }
+
+        /*!
+         * \brief Waits for a result, and returns it.
+         * \details While waiting, the calling thread runs the tasks of the queue, so a task of the pool can wait for other tasks.
+         * The main thread also runs the tasks given with MainThread::run, so the results needing it can be waited from the main thread.
+         */
+        template <typename T>
+        T wait(std::future<T> &future) {
+            while(future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                if(runTask()) {
+                    continue;
+                }
+                if(MainThread::isMainThread()) {
+                    MainThread::processTasks(std::chrono::milliseconds(1));
+                } else {
+                    future.wait_for(std::chrono::milliseconds(1));
+                }
+            }
+            return future.get();
+        }
+
+    } // namespace ThreadPool
+} // namespace Utils